@@ -0,0 +1,79 @@
+/*
+Compares the plain iostream path with Writer for a high volume of colored log lines written to a file or a pipe.
+Writer uses write(2), or io_uring when built with CLISTYLE_USE_IO_URING.
+
+Build and run from the repository root, the lines go to the path given (a temporary file by default)
+and the timings to the standard error:
+  g++ -std=c++17 -O2 -I. benchmarks/writer.cpp -o writer && ./writer
+  g++ -std=c++17 -O2 -I. -DCLISTYLE_USE_IO_URING benchmarks/writer.cpp -o writer_uring && ./writer_uring
+  ./writer_uring /dev/stdout | cat > /dev/null
+*/
+
+#include <cstdio>
+#include <cstdlib>
+
+//Forces the colors before the header detects the terminal, this object is initialized first since it's defined first.
+static const bool colors_forced = [] {
+  setenv("FORCE_COLOR", "3", 1);
+  return true;
+}();
+
+#include "clistyle.hpp"
+
+#include <fcntl.h>
+#include <fstream>
+
+using namespace CLIStyle;
+
+constexpr int LINES = 2000000;
+constexpr int RUNS = 7;
+constexpr std::size_t CAPACITY = 8192;
+
+//Runs the function RUNS times and returns the median duration in milliseconds.
+template <typename Function>
+double median(Function function) {
+  std::vector<double> durations;
+  for (int run = 0; run < RUNS; run++) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    durations.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+  }
+  std::sort(durations.begin(), durations.end());
+  return durations[RUNS / 2];
+}
+
+int main(int argc, char** argv) {
+  const char* path = argc > 1 ? argv[1] : "clistyle_benchmark.log";
+  const bool regular_file = argc <= 1;
+
+  const double stream_time = median([&] {
+    std::ofstream os(path, std::ios::trunc);
+    os << enable_colors;
+    for (int line = 0; line < LINES; line++) {
+      os << red << "error " << reset << line << " request failed while reading the configuration\n";
+    }
+  });
+
+  const double writer_time = median([&] {
+    const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    {
+      Writer out(fd, FlushPolicy::full, CAPACITY);
+      const Style error = fg(Color::red);
+      for (int line = 0; line < LINES; line++) {
+        out << error << "error " << Style() << line << " request failed while reading the configuration\n";
+      }
+    }
+    close(fd);
+  });
+
+  if (regular_file) std::remove(path);
+  #ifdef CLISTYLE_IO_URING
+  const char* backend = "io_uring";
+  #else
+  const char* backend = "write(2)";
+  #endif
+  std::fprintf(stderr, "%d lines, median of %d runs, %zu byte buffer\n", LINES, RUNS, CAPACITY);
+  std::fprintf(stderr, "iostream           %8.1f ms\n", stream_time);
+  std::fprintf(stderr, "Writer (%s)  %8.1f ms\n", backend, writer_time);
+  return EXIT_SUCCESS;
+}
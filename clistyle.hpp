@@ -24,1856 +24,6829 @@ THE SOFTWARE.
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <ios>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
-#include <unordered_map> 
-
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cerrno> //for the EINTR error
+#include <cstddef> //for the size_t type
 #include <cstdint> //for the uint8_t type
+#include <cstring> //for the memcpy function
 #include <cstdlib> //for the exit function
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CLISTYLE_SSE2
+#include <emmintrin.h> //for the SSE2 scans and batch conversions
+#endif
+
+#ifdef __AVX2__
+#include <immintrin.h> //for the AVX2 scans
+#endif
+
+//Number of escape codes every thread keeps in its cache of runtime styles, must be a power of 2.
+#ifndef CLISTYLE_SEQUENCE_CACHE_SIZE
+#define CLISTYLE_SEQUENCE_CACHE_SIZE 256
+#endif
+
+//Define CLISTYLE_USE_IO_URING to send the buffers of Writer through io_uring on Linux, write(2) is used when the kernel refuses.
+#if defined(CLISTYLE_USE_IO_URING) && defined(__linux__)
+#define CLISTYLE_IO_URING
+#include <linux/io_uring.h> //for the ring structures, the system calls are made directly
+#include <sys/mman.h> //for the mmap function
+#include <sys/syscall.h> //for the io_uring system call numbers
+#endif
+
 #ifdef _WIN32
 #include <windows.h>
+#include <io.h> //for the _isatty function
 #else
+#include <unistd.h> //for the isatty function
+#include <sys/uio.h> //for the writev function
+#include <climits> //for the IOV_MAX limit
 #endif
 
 using std::cout, std::endl;
-using std::string, std::to_string, std::unordered_map;
+using std::string, std::to_string;
 using std::ostream;
 
 //Check if the user is on Windows, if true includes the library for the Windows API otherwise it doesn't
 
 namespace CLIStyle {
-  
-  //This namespace contains all the functions that the user shouldn't access
-
-  namespace _private {
-
-    //Maps style names to their corresponding ANSI escape codes.
-    inline unordered_map<string, string> styles = 
-    { 
-      {"bold", "\033[1m"},
-      {"italic", "\033[3m"}, 
-      {"underline", "\033[4m"}, 
-      {"reverse", "\033[7m"} 
-    };
-
-    //Maps color names to their corresponding ANSI escape codes for text.
-    inline unordered_map<string, string> color_text = {
-      {"grey", "\033[30m"},
-      {"red", "\033[31m"},
-      {"green", "\033[32m"},
-      {"yellow", "\033[33m"},
-      {"blue", "\033[34m"},
-      {"magenta", "\033[35m"},
-      {"cyan", "\033[36m"},
-      {"white", "\033[37m"},
-      {"bright grey", "\033[1;30m"},
-      {"bright red", "\033[1;31m"},
-      {"bright green", "\033[1;32m"},
-      {"bright yellow", "\033[1;33m"},
-      {"bright blue", "\033[1;34m"},
-      {"bright magenta", "\033[1;35m"},
-      {"bright cyan", "\033[1;36m"},
-      {"bright white", "\033[1;37m"}
-    };
 
-    //Maps color names to their corresponding ANSI escape codes for background.
-    inline unordered_map<string, string> color_background = {
-      {"grey", "\033[40m"},
-      {"red", "\033[41m"},
-      {"green", "\033[42m"},
-      {"yellow", "\033[43m"},
-      {"blue", "\033[44m"},
-      {"magenta", "\033[45m"},
-      {"cyan", "\033[46m"},
-      {"white", "\033[47m"},
-      {"bright grey", "\033[1;40m"},
-      {"bright red", "\033[1;41m"},
-      {"bright green", "\033[1;42m"},
-      {"bright yellow", "\033[1;43m"},
-      {"bright blue", "\033[1;44m"},
-      {"bright magenta", "\033[1;45m"},
-      {"bright cyan", "\033[1;46m"},
-      {"bright white", "\033[1;47m"}
-    };
+  //Names of the standard and bright colors, used as indexes in the escape tables.
+  enum class Color : uint8_t {
+    grey, red, green, yellow, blue, magenta, cyan, white,
+    bright_grey, bright_red, bright_green, bright_yellow, bright_blue, bright_magenta, bright_cyan, bright_white
+  };
+
+  //How many colors an output can show, from none to 24 bit colors.
+  enum class ColorDepth : uint8_t {
+    none, basic, palette, truecolor
+  };
+
+  //Names of the text styles, used as indexes in the escape tables.
+  enum class Attribute : uint8_t {
+    bold, italic, underline, reverse, dim, blink, conceal, strikethrough, double_underline, curly_underline, overline
+  };
+
+  //A custom color made of its red, green and blue components.
+  struct Rgb {
+    uint8_t red = 0;
+    uint8_t green = 0;
+    uint8_t blue = 0;
+  };
 
-    constexpr auto RESET_STYLE = "\033[0m";
+  /**
+   * @brief Packed combination of a text color, a background color and text styles.
+   * 
+   * It's trivially copyable and fits in 16 bytes, so it's cheap to store and pass around.
+   * Build it with fg(), bg() and the Attribute values, and combine them with operator|.
+   * 
+   * Example: Style error = Attribute::bold | fg(Color::red) | bg(Color::blue);
+  */
+  struct Style {
+    //What kind of color is stored in the foreground or in the background.
+    enum class ColorKind : uint8_t { none, named, rgb, palette };
 
-    inline bool handleVTSequences = false; //checks if the user terminal can access the ANSI code
+    uint16_t attributes = 0; //One bit for every Attribute
+    uint8_t kinds = 0; //Foreground ColorKind in the low nibble, background ColorKind in the high nibble
+    uint8_t underline_kind = 0; //ColorKind of the underline, only palette and RGB colors
+    uint8_t foreground[3] = {}; //Color index for named and palette colors, red, green and blue for RGB colors
+    uint8_t background[3] = {}; //Color index for named and palette colors, red, green and blue for RGB colors
+    uint8_t underline[3] = {}; //Color index for palette colors, red, green and blue for RGB colors
 
-    #ifdef _WIN32 // check if the user is on Windows
-    /**
-     * @brief Enables virtual terminal sequence processing for the console output.
-     * 
-     * @param handleVTSequences A reference to a boolean flag indicating whether the user terminal can handle VT sequences.
-    */
-    inline void enableVTSequences(bool& handleVTSequences) {
-      HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-      if (hOut == INVALID_HANDLE_VALUE)
-      {
-        std::cerr << "Couldn't get the console handle. Quitting.\n" << std::endl;
-        exit(EXIT_FAILURE);
-      }
+    constexpr Style() = default;
 
-      DWORD dwMode = 0;
-      if (!GetConsoleMode(hOut, &dwMode))
-      {
-        std::cerr << "Unable to enter VT processing mode. Quitting.\n" << std::endl;
-        exit(EXIT_FAILURE);
-      }
+    constexpr Style(Attribute attribute) : attributes(static_cast<uint16_t>(1u << static_cast<uint8_t>(attribute))) {}
 
-      dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
-      if (!SetConsoleMode(hOut, dwMode))
-      {
-        std::cerr << "Unable to enter VT processing mode. Quitting.\n" << std::endl;
-        exit(EXIT_FAILURE);
-      }
-      handleVTSequences = true;
+    constexpr ColorKind foregroundKind() const {
+      return static_cast<ColorKind>(kinds & 0x0F);
     }
-    #else //If not on Windows, runs a simplifed function just for code reusability
 
-    inline void enableVTSequences(bool& handleVTSequences) {
-      handleVTSequences = true;
+    constexpr ColorKind backgroundKind() const {
+      return static_cast<ColorKind>(kinds >> 4);
     }
-    #endif
 
-    /**
-     * @brief Generates an ANSI escape code for the background or for the text based on the position
-     * 
-     * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
-     * @tparam red Red component of the color (0-255).
-     * @tparam green Green component of the color (0-255).
-     * @tparam blue Blue component of the color (0-255).
-     * @return The ANSI escape code for the specified color either for the background or for the text.
-    */
-    template <uint8_t position, uint8_t red, uint8_t green, uint8_t blue>
-    string getColor(){
-      if (position == 1){ // TEXT
-        return "\033[38;2;" + to_string(red) + ";" + to_string(green) + ";" + to_string(blue) + "m";
-      }
-      else { // BACKGROUND
-        return "\033[48;2;" + to_string(red) + ";" + to_string(green) + ";" + to_string(blue) + "m";
-      }
+    constexpr ColorKind underlineKind() const {
+      return static_cast<ColorKind>(underline_kind);
     }
 
-    /**
-     * @brief Applies a color to the given text based on the templates parameters
-     * 
-     * @tparam red Red component of the color (0-255).
-     * @tparam green Green component of the color (0-255).
-     * @tparam blue Blue component of the color (0-255).
-     * 
-     * @param text The text to color.
-     * 
-     * @return The colored text followed by the reset style.
-    */
-    template <uint8_t red, uint8_t green, uint8_t blue>
-    string colorText(const string& text) {
-      const string color = getColor<1, red, green, blue>();
-      return color + text + RESET_STYLE;
-    }
-    
-    /**
-     * @brief Returns a color based on the templates parameters.
-     * 
-     * @tparam red Red component of the color (0-255).
-     * @tparam green Green component of the color (0-255).
-     * @tparam blue Blue component of the color (0-255).
-     * @return The color calculated from the temlate parameters.
-    */
-    template <uint8_t red, uint8_t green, uint8_t blue>
-    string colorText() {
-      const string color = getColor<1, red, green, blue>();
-      return color;
+    constexpr bool has(Attribute attribute) const {
+      return (attributes >> static_cast<uint8_t>(attribute)) & 1u;
     }
 
-    /**
-     * @brief Applies a color for the background based on the templates parameters
-     * 
-     * @tparam red Red component of the color (0-255).
-     * @tparam green Green component of the color (0-255).
-     * @tparam blue Blue component of the color (0-255).
-     * 
-     * @param text The text to color.
-     * 
-     * @return The colored background followed by the reset style.
-    */
-    template <uint8_t red, uint8_t green, uint8_t blue>
-    string colorBackground(const string& text) {
-      const string color = getColor<0, red, green, blue>();
-      return color + text + RESET_STYLE;
+    constexpr bool empty() const {
+      return attributes == 0 && kinds == 0 && underline_kind == 0;
     }
+  };
 
-    /**
-     * @brief Returns a color for the background based on the templates parameters.
-     * 
-     * @tparam red Red component of the color (0-255).
-     * @tparam green Green component of the color (0-255).
-     * @tparam blue Blue component of the color (0-255).
-     * 
-     * @param text The text to color.
-     * 
-     * @return The colored text followed by the reset style.
-    */
-    template <uint8_t red, uint8_t green, uint8_t blue>
-    string colorBackground() {
-      const string color = getColor<0, red, green, blue>();
-      return color;
-    }
+  static_assert(sizeof(Style) <= 16, "Style must stay packed in 16 bytes");
 
-    /**
-     * @brief Check if a given position is equal to TEXT (1) or to BACKGROUND (0), otherwise throws an error
-    */
-    inline void checkPosition(uint8_t position){
-      if (position != 1 && position != 0){
-        std::cerr << "Position must be either 0 or 1";
-        exit(EXIT_FAILURE);
-      }
-    }
+  constexpr bool operator==(const Style& left, const Style& right) {
+    return left.attributes == right.attributes && left.kinds == right.kinds && left.underline_kind == right.underline_kind &&
+      left.foreground[0] == right.foreground[0] && left.foreground[1] == right.foreground[1] && left.foreground[2] == right.foreground[2] &&
+      left.background[0] == right.background[0] && left.background[1] == right.background[1] && left.background[2] == right.background[2] &&
+      left.underline[0] == right.underline[0] && left.underline[1] == right.underline[1] && left.underline[2] == right.underline[2];
   }
 
-  constexpr uint8_t TEXT = 1;
-  constexpr uint8_t BACKGROUND = 0;
-
-  /**
-   * @brief Returns the stream with the a color, specified from the template params, for the background or text.
-   * 
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
-   * @tparam red Red component of the color (0-255).
-   * @tparam green Green component of the color (0-255).
-   * @tparam blue Blue component of the color (0-255).
-   * 
-   * @param os The stream to apply the color to.
-   * 
-   * @return The modified stream.
-  */
-  template <uint8_t position, uint8_t red, uint8_t green, uint8_t blue>
-  ostream& color(ostream& os){
-    _private::checkPosition(position);
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    os << _private::getColor<position, red, green, blue>();
-    return os;
+  constexpr bool operator!=(const Style& left, const Style& right) {
+    return !(left == right);
   }
 
   /**
-   * @brief Applies the specified color, specified from the template params, to the text or background.
-   * 
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
-   * @tparam red Red component of the color (0-255).
-   * @tparam green Green component of the color (0-255).
-   * @tparam blue Blue component of the color (0-255).
-   * 
-   * @param text The text to color.
-   * 
-   * @return The modified text with the applied color.
-  */
-  template <uint8_t position, uint8_t red, uint8_t green, uint8_t blue>
-  string color(const string& text) {
-    _private::checkPosition(position);
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    return position == TEXT ? _private::colorText<red, green, blue>(text) : _private::colorBackground<red, green, blue>(text);
-  }
-  
-  /**
-   * @brief Applies the specified color, specified from the template params, to the text.
+   * @brief Combines two styles, the attributes are merged and the colors of the right style win when set.
    * 
-   * @tparam red Red component of the color (0-255).
-   * @tparam green Green component of the color (0-255).
-   * @tparam blue Blue component of the color (0-255).
+   * The underline styles replace each other like on the terminal, so an underline of the right style wins too.
    * 
-   * @param text The text to color.
+   * @param left The base style.
+   * @param right The style applied over the base one.
    * 
-   * @return The modified text with the applied color.
+   * @return The combined style.
   */
-  template<uint8_t red, uint8_t green, uint8_t blue>
-  string color(const string& text) {
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    return _private::colorText<red, green, blue>(text);
+  constexpr Style operator|(Style left, const Style& right) {
+    constexpr uint16_t underlines = static_cast<uint16_t>((1u << static_cast<uint8_t>(Attribute::underline)) |
+      (1u << static_cast<uint8_t>(Attribute::double_underline)) | (1u << static_cast<uint8_t>(Attribute::curly_underline)));
+    if (right.attributes & underlines) left.attributes = static_cast<uint16_t>(left.attributes & ~underlines);
+    left.attributes |= right.attributes;
+    if (right.foregroundKind() != Style::ColorKind::none) {
+      left.kinds = static_cast<uint8_t>((left.kinds & 0xF0) | (right.kinds & 0x0F));
+      left.foreground[0] = right.foreground[0];
+      left.foreground[1] = right.foreground[1];
+      left.foreground[2] = right.foreground[2];
+    }
+    if (right.backgroundKind() != Style::ColorKind::none) {
+      left.kinds = static_cast<uint8_t>((left.kinds & 0x0F) | (right.kinds & 0xF0));
+      left.background[0] = right.background[0];
+      left.background[1] = right.background[1];
+      left.background[2] = right.background[2];
+    }
+    if (right.underlineKind() != Style::ColorKind::none) {
+      left.underline_kind = right.underline_kind;
+      left.underline[0] = right.underline[0];
+      left.underline[1] = right.underline[1];
+      left.underline[2] = right.underline[2];
+    }
+    return left;
   }
 
   /**
-   * @brief Applies to the stream the color specified from the template params.
-   * 
-   * @tparam red Red component of the color (0-255).
-   * @tparam green Green component of the color (0-255).
-   * @tparam blue Blue component of the color (0-255).
+   * @brief Combines two attributes into a style.
    * 
-   * @param os The stream to apply the color to.
+   * @param left The first attribute.
+   * @param right The second attribute.
    * 
-   * @return The modified stream.
+   * @return The style with both attributes.
   */
-  template<uint8_t red, uint8_t green, uint8_t blue>
-  ostream& color(ostream& os) {
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    os <<  _private::colorBackground<red, green, blue>();
-    return os;
+  constexpr Style operator|(Attribute left, Attribute right) {
+    return Style(left) | Style(right);
   }
 
   /**
-   * @brief Applies the specified color, specified from the template params, to the background.
-   * 
-   * @tparam red Red component of the color (0-255).
-   * @tparam green Green component of the color (0-255).
-   * @tparam blue Blue component of the color (0-255).
+   * @brief Returns a style with one of the standard or bright colors for the text.
    * 
-   * @param text The text to color.
+   * @param color The color of the text.
    * 
-   * @return The modified text with the applied background color.
+   * @return The style with the text color.
   */
-  template<uint8_t red, uint8_t green, uint8_t blue>
-  string on_color(const string& text) {
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    return _private::colorText<red, green, blue>(text);
+  constexpr Style fg(Color color) {
+    Style style;
+    style.kinds = static_cast<uint8_t>(Style::ColorKind::named);
+    style.foreground[0] = static_cast<uint8_t>(color);
+    return style;
   }
 
   /**
-   * @brief Applies to the stream the color specified from the template params.
-   * 
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
-   * @tparam red Red component of the color (0-255).
-   * @tparam green Green component of the color (0-255).
-   * @tparam blue Blue component of the color (0-255).
+   * @brief Returns a style with one of the standard or bright colors for the background.
    * 
-   * @param os The stream to apply the color to.
+   * @param color The color of the background.
    * 
-   * @return The modified stream.
+   * @return The style with the background color.
   */
-  template<uint8_t red, uint8_t green, uint8_t blue>
-  ostream& on_color(ostream& os) {
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    os <<  _private::colorBackground<red, green, blue>();
-    return os;
+  constexpr Style bg(Color color) {
+    Style style;
+    style.kinds = static_cast<uint8_t>(static_cast<uint8_t>(Style::ColorKind::named) << 4);
+    style.background[0] = static_cast<uint8_t>(color);
+    return style;
   }
 
-  // Functions for grey color
-
   /**
-   * @brief Applies the color grey either for the background or for the text, based on the position
-   * 
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @brief Returns a style with a custom color for the text.
    * 
-   * @param os The stream to apply the color to.
+   * @param red Red component of the color (0-255).
+   * @param green Green component of the color (0-255).
+   * @param blue Blue component of the color (0-255).
    * 
-   * @return The modified stream.
+   * @return The style with the text color.
   */
-  template<uint8_t position>
-  ostream& grey(ostream& os){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    _private::checkPosition(position);
-    os << ((position == TEXT) ? _private::color_text["grey"] : _private::color_background["grey"]);
-    return os;
+  constexpr Style fg(uint8_t red, uint8_t green, uint8_t blue) {
+    Style style;
+    style.kinds = static_cast<uint8_t>(Style::ColorKind::rgb);
+    style.foreground[0] = red;
+    style.foreground[1] = green;
+    style.foreground[2] = blue;
+    return style;
   }
 
   /**
-   * @brief Applies the color grey either for the background or for the text, based on the position
+   * @brief Returns a style with a custom color for the background.
    * 
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
-   * 
-   * @param text The text to color.
+   * @param red Red component of the color (0-255).
+   * @param green Green component of the color (0-255).
+   * @param blue Blue component of the color (0-255).
    * 
-   * @return The modified text with the grey color.
+   * @return The style with the background color.
   */
-
-  template<uint8_t position>
-  string grey(const string& text) {
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    _private::checkPosition(position);
-    const string grey = (position == TEXT) ? _private::color_text["grey"] : _private::color_background["grey"];
-    return grey + text + _private::RESET_STYLE;
+  constexpr Style bg(uint8_t red, uint8_t green, uint8_t blue) {
+    Style style;
+    style.kinds = static_cast<uint8_t>(static_cast<uint8_t>(Style::ColorKind::rgb) << 4);
+    style.background[0] = red;
+    style.background[1] = green;
+    style.background[2] = blue;
+    return style;
   }
 
   /**
-   * @brief Applies the color grey to the text
+   * @brief Returns a style with a color of the xterm 256 color palette for the text.
    * 
-   * @param text The text to color.
+   * @param index The index of the color in the palette (0-255).
    * 
-   * @return The modified text with the grey color.
+   * @return The style with the text color.
   */
-  inline string grey(const string& text) {
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    const string grey = _private::color_text["grey"];
-    return grey + text + _private::RESET_STYLE;
+  constexpr Style fg256(uint8_t index) {
+    Style style;
+    style.kinds = static_cast<uint8_t>(Style::ColorKind::palette);
+    style.foreground[0] = index;
+    return style;
   }
 
   /**
-   * @brief Applies the color grey to the text
+   * @brief Returns a style with a color of the xterm 256 color palette for the background.
    * 
-   * @param os The stream to apply the color to.
+   * @param index The index of the color in the palette (0-255).
    * 
-   * @return The modified stream.
+   * @return The style with the background color.
   */
-  inline ostream& grey(ostream& os){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    os << _private::color_text["grey"];
-    return os;
+  constexpr Style bg256(uint8_t index) {
+    Style style;
+    style.kinds = static_cast<uint8_t>(static_cast<uint8_t>(Style::ColorKind::palette) << 4);
+    style.background[0] = index;
+    return style;
   }
 
   /**
-   * @brief Applies the color grey to the background
+   * @brief Returns a style with a custom color for the underline, shown by the underline attributes.
    * 
-   * @param text The text to color.
+   * @param red Red component of the color (0-255).
+   * @param green Green component of the color (0-255).
+   * @param blue Blue component of the color (0-255).
    * 
-   * @return The modified text with the grey color.
+   * @return The style with the underline color.
   */
-  inline string on_grey(const string& text){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    const string grey = _private::color_background["grey"];
-    return grey + text + _private::RESET_STYLE;
+  constexpr Style ul(uint8_t red, uint8_t green, uint8_t blue) {
+    Style style;
+    style.underline_kind = static_cast<uint8_t>(Style::ColorKind::rgb);
+    style.underline[0] = red;
+    style.underline[1] = green;
+    style.underline[2] = blue;
+    return style;
   }
 
   /**
-   * @brief Applies the color grey to the background
+   * @brief Returns a style with a color of the xterm 256 color palette for the underline.
    * 
-   * @param os The stream to apply the color to.
+   * @param index The index of the color in the palette (0-255).
    * 
-   * @return The modified stream.
+   * @return The style with the underline color.
   */
-  inline ostream& on_grey(ostream& os){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    os << _private::color_background["grey"];
-    return os;
+  constexpr Style ul256(uint8_t index) {
+    Style style;
+    style.underline_kind = static_cast<uint8_t>(Style::ColorKind::palette);
+    style.underline[0] = index;
+    return style;
   }
+  
+  //This namespace contains all the functions that the user shouldn't access
 
-  // Functions for bright grey color
-  /**
-   * @brief Applies a bright grey color to the text or background based on the position.
-   *
-   * This function applies the bright grey color to the specified position (either text or background).
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the bright grey color applied.
-  */
-  template<uint8_t position>
-  ostream& bright_grey(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["bright grey"] : _private::color_background["bright grey"]);
-    return os;
-  }
+  namespace _private {
 
-  /**
-   * @brief Applies a bright grey color to the text based on the position.
-   *
-   * This function applies the bright grey color to the specified position (either text or background).
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the bright grey color will be applied.
-   * @return The modified text with the bright grey color applied.
+    /**
+     * @brief Fixed-size table of escape codes that can be indexed directly by an enum.
+     * 
+     * @tparam Key The enum used as an index.
+     * @tparam size The number of entries in the table.
+    */
+    template <typename Key, std::size_t size>
+    struct EscapeTable {
+      std::string_view codes[size];
+
+      constexpr std::string_view operator[](Key key) const {
+        return codes[static_cast<std::size_t>(key)];
+      }
+    };
+
+    //Maps styles to their corresponding ANSI escape codes.
+    inline constexpr EscapeTable<Attribute, 11> styles = {{
+      "\033[1m",   // bold
+      "\033[3m",   // italic
+      "\033[4m",   // underline
+      "\033[7m",   // reverse
+      "\033[2m",   // dim
+      "\033[5m",   // blink
+      "\033[8m",   // conceal
+      "\033[9m",   // strikethrough
+      "\033[21m",  // double underline
+      "\033[4:3m", // curly underline
+      "\033[53m"   // overline
+    }};
+
+    //Maps colors to their corresponding ANSI escape codes for text.
+    inline constexpr EscapeTable<Color, 16> color_text = {{
+      "\033[30m", // grey
+      "\033[31m", // red
+      "\033[32m", // green
+      "\033[33m", // yellow
+      "\033[34m", // blue
+      "\033[35m", // magenta
+      "\033[36m", // cyan
+      "\033[37m", // white
+      "\033[1;30m", // bright grey
+      "\033[1;31m", // bright red
+      "\033[1;32m", // bright green
+      "\033[1;33m", // bright yellow
+      "\033[1;34m", // bright blue
+      "\033[1;35m", // bright magenta
+      "\033[1;36m", // bright cyan
+      "\033[1;37m"  // bright white
+    }};
+
+    //Maps colors to their corresponding ANSI escape codes for background.
+    inline constexpr EscapeTable<Color, 16> color_background = {{
+      "\033[40m", // grey
+      "\033[41m", // red
+      "\033[42m", // green
+      "\033[43m", // yellow
+      "\033[44m", // blue
+      "\033[45m", // magenta
+      "\033[46m", // cyan
+      "\033[47m", // white
+      "\033[1;40m", // bright grey
+      "\033[1;41m", // bright red
+      "\033[1;42m", // bright green
+      "\033[1;43m", // bright yellow
+      "\033[1;44m", // bright blue
+      "\033[1;45m", // bright magenta
+      "\033[1;46m", // bright cyan
+      "\033[1;47m"  // bright white
+    }};
+
+    inline constexpr std::string_view RESET_STYLE = "\033[0m";
+
+    #ifdef _WIN32 // check if the user is on Windows
+    /**
+     * @brief Enables virtual terminal sequence processing for a console output.
+     * 
+     * @param fd The file descriptor of the output, 1 for the standard output or 2 for the standard error.
+     * 
+     * @return True if the console can handle VT sequences, false if the output isn't a console that supports them.
+    */
+    inline bool enableVTSequences(int fd) {
+      HANDLE hOut = GetStdHandle(fd == 2 ? STD_ERROR_HANDLE : STD_OUTPUT_HANDLE);
+      if (hOut == INVALID_HANDLE_VALUE)
+      {
+        return false;
+      }
+
+      DWORD dwMode = 0;
+      if (!GetConsoleMode(hOut, &dwMode))
+      {
+        return false;
+      }
+
+      dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+      if (!SetConsoleMode(hOut, dwMode))
+      {
+        return false;
+      }
+      return true;
+    }
+
+    //Checks if a file descriptor is connected to a terminal.
+    inline bool isTerminal(int fd) {
+      return _isatty(fd) != 0;
+    }
+    #else //If not on Windows, runs a simplifed function just for code reusability
+
+    inline bool enableVTSequences(int) {
+      return true;
+    }
+
+    //Checks if a file descriptor is connected to a terminal.
+    inline bool isTerminal(int fd) {
+      return isatty(fd) != 0;
+    }
+    #endif
+
+    /**
+     * @brief Reads an environment variable.
+     * 
+     * @return The value of the variable, or an empty view when it isn't set.
+    */
+    inline std::string_view environment(const char* name) {
+      const char* value = std::getenv(name);
+      return value ? std::string_view(value) : std::string_view();
+    }
+
+    /**
+     * @brief Finds how many colors an output can show, from the FORCE_COLOR, NO_COLOR, TERM and COLORTERM variables.
+     * 
+     * FORCE_COLOR wins over everything else: 0 or false disables the colors, 1 (or empty), 2 and 3 force
+     * at least 16 colors, 256 colors and truecolor. Otherwise the colors are disabled when NO_COLOR is set,
+     * when the output isn't a terminal or when TERM is "dumb".
+     * 
+     * @param fd The file descriptor of the output, 1 for the standard output or 2 for the standard error.
+     * 
+     * @return The color depth of the output.
+    */
+    inline ColorDepth detectColorDepth(int fd) {
+      const char* force = std::getenv("FORCE_COLOR");
+      ColorDepth forced = ColorDepth::none;
+      if (force) {
+        const std::string_view value(force);
+        if (value == "0" || value == "false") return ColorDepth::none;
+        forced = value == "3" ? ColorDepth::truecolor : value == "2" ? ColorDepth::palette : ColorDepth::basic;
+      }
+
+      const bool vt_sequences = enableVTSequences(fd);
+      if (!force) {
+        if (!environment("NO_COLOR").empty()) return ColorDepth::none;
+        if (!isTerminal(fd) || !vt_sequences) return ColorDepth::none;
+      }
+
+      const std::string_view term = environment("TERM");
+      const std::string_view colorterm = environment("COLORTERM");
+      ColorDepth detected = ColorDepth::basic;
+      if (colorterm == "truecolor" || colorterm == "24bit" || term.find("direct") != std::string_view::npos) detected = ColorDepth::truecolor;
+      else if (term.find("256color") != std::string_view::npos) detected = ColorDepth::palette;
+      #ifdef _WIN32
+      else if (vt_sequences) detected = ColorDepth::truecolor; //Windows consoles with VT processing support 24 bit colors
+      #endif
+      else if (term == "dumb" && !force) return ColorDepth::none;
+
+      return detected > forced ? detected : forced;
+    }
+
+    /**
+     * @brief What the standard output and the standard error can show.
+     * 
+     * It's constant-initialized to none, so it can be read even from the static initializers that run before the probe,
+     * and it's atomic, so init() can probe again while other threads color their output.
+    */
+    struct Capabilities {
+      std::atomic<ColorDepth> output{ColorDepth::none};
+      std::atomic<ColorDepth> error{ColorDepth::none};
+    };
+
+    inline Capabilities terminal;
+
+    //Detects what the standard output and the standard error can show and publishes it.
+    inline void probeTerminal() {
+      terminal.output.store(detectColorDepth(1), std::memory_order_relaxed);
+      terminal.error.store(detectColorDepth(2), std::memory_order_relaxed);
+    }
+
+    //Probes the terminal during static initialization, so the functions that color the output only read the published result.
+    inline const bool terminal_probed = (probeTerminal(), true);
+
+    //Returns what the standard output can show.
+    inline ColorDepth outputDepth() {
+      return terminal.output.load(std::memory_order_relaxed);
+    }
+
+    //Returns what the standard error can show.
+    inline ColorDepth errorDepth() {
+      return terminal.error.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the capability of the output behind a stream.
+     * 
+     * std::cerr and std::clog use the standard error, every other stream uses the standard output.
+    */
+    inline ColorDepth streamColorDepth(const std::ios_base& stream) {
+      return (&stream == &std::cerr || &stream == &std::clog) ? errorDepth() : outputDepth();
+    }
+
+    /**
+     * @brief Returns the capability of a file descriptor.
+     * 
+     * The standard output and the standard error use the cached result, any other descriptor is probed.
+    */
+    inline ColorDepth fdColorDepth(int fd) {
+      if (fd == 1) return outputDepth();
+      if (fd == 2) return errorDepth();
+      return detectColorDepth(fd);
+    }
+
+    //Number of file descriptors whose capability is remembered by cachedFdColorDepth().
+    constexpr int FD_DEPTH_CACHE_SIZE = 256;
+
+    /**
+     * @brief Returns the capability of a file descriptor, probing it only the first time.
+     * 
+     * A descriptor closed and reused for another output keeps the first result, descriptors past the cache are always probed.
+    */
+    inline ColorDepth cachedFdColorDepth(int fd) {
+      if (fd <= 2 || fd >= FD_DEPTH_CACHE_SIZE) return fdColorDepth(fd); //The standard outputs read the published result, that init() can update
+      static std::atomic<uint8_t> depths[FD_DEPTH_CACHE_SIZE]; //0 when not probed yet, otherwise the depth + 1
+      uint8_t known = depths[fd].load(std::memory_order_relaxed);
+      if (known == 0) {
+        known = static_cast<uint8_t>(static_cast<uint8_t>(fdColorDepth(fd)) + 1);
+        depths[fd].store(known, std::memory_order_relaxed);
+      }
+      return static_cast<ColorDepth>(known - 1);
+    }
+
+    /**
+     * @brief Builds a styled string made of the escape code, the text and the reset style.
+     * 
+     * The final size is computed up front, so the result is allocated only once.
+     * When the standard output can't show colors, the text is returned unchanged.
+     * 
+     * @param code The escape code placed before the text.
+     * @param text The text to style.
+     * 
+     * @return The styled text followed by the reset style.
+    */
+    inline string buildStyled(std::string_view code, const string& text) {
+      if (outputDepth() == ColorDepth::none) return text;
+      string result;
+      result.reserve(code.size() + text.size() + RESET_STYLE.size());
+      result.append(code).append(text).append(RESET_STYLE);
+      return result;
+    }
+
+    /**
+     * @brief Builds a styled string reusing the buffer of the given text.
+     * 
+     * The text is grown at most once, and not at all when its capacity is already large enough.
+     * 
+     * @param code The escape code placed before the text.
+     * @param text The text to style, moved into the result.
+     * 
+     * @return The styled text followed by the reset style.
+    */
+    inline string buildStyled(std::string_view code, string&& text) {
+      if (outputDepth() == ColorDepth::none) return std::move(text);
+      text.reserve(code.size() + text.size() + RESET_STYLE.size());
+      text.insert(0, code);
+      text.append(RESET_STYLE);
+      return std::move(text);
+    }
+
+    //Decimal text of every number from 0 to 255, padded to 3 characters, with its length in the last character.
+    inline constexpr std::array<std::array<char, 4>, 256> decimal_digits = [] {
+      std::array<std::array<char, 4>, 256> digits{};
+      for (int number = 0; number < 256; number++) {
+        int length = 0;
+        if (number >= 100) digits[number][length++] = static_cast<char>('0' + number / 100);
+        if (number >= 10) digits[number][length++] = static_cast<char>('0' + number / 10 % 10);
+        digits[number][length++] = static_cast<char>('0' + number % 10);
+        digits[number][3] = static_cast<char>(length);
+      }
+      return digits;
+    }();
+
+    /**
+     * @brief Fixed-size character buffer that can be filled at compile time.
+     * 
+     * @tparam capacity The maximum number of characters the buffer can hold.
+    */
+    template <std::size_t capacity>
+    struct FixedString {
+      char data[capacity + 1] = {};
+      std::size_t length = 0;
+
+      constexpr void append(std::string_view text) {
+        for (const char character : text) data[length++] = character;
+      }
+
+      constexpr void appendNumber(uint8_t number) {
+        const std::array<char, 4>& digits = decimal_digits[number];
+        for (int index = 0; index < digits[3]; index++) data[length++] = digits[index];
+      }
+
+      constexpr std::string_view view() const {
+        return std::string_view(data, length);
+      }
+    };
+
+    //Length of the longest RGB escape code: "\033[38;2;255;255;255m"
+    constexpr std::size_t RGB_SEQUENCE_SIZE = 19;
+
+    /**
+     * @brief Builds at compile time the ANSI escape code for an RGB color.
+     * 
+     * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+     * @tparam red Red component of the color (0-255).
+     * @tparam green Green component of the color (0-255).
+     * @tparam blue Blue component of the color (0-255).
+     * @return The escape code stored in a fixed-size buffer.
+    */
+    template <uint8_t position, uint8_t red, uint8_t green, uint8_t blue>
+    constexpr FixedString<RGB_SEQUENCE_SIZE> makeColor() {
+      FixedString<RGB_SEQUENCE_SIZE> sequence;
+      sequence.append(position == 1 ? "\033[38;2;" : "\033[48;2;");
+      sequence.appendNumber(red);
+      sequence.append(";");
+      sequence.appendNumber(green);
+      sequence.append(";");
+      sequence.appendNumber(blue);
+      sequence.append("m");
+      return sequence;
+    }
+
+    /**
+     * @brief Finds the level of the xterm 6x6x6 color cube closest to a color component.
+     * 
+     * The cube levels are 0, 95, 135, 175, 215 and 255.
+    */
+    constexpr uint8_t cubeLevel(uint8_t component) {
+      if (component < 48) return 0;
+      if (component < 114) return 1;
+      return static_cast<uint8_t>((component - 35) / 40);
+    }
+
+    //Maps every color component to its closest level in the xterm color cube.
+    inline constexpr std::array<uint8_t, 256> cube_levels = [] {
+      std::array<uint8_t, 256> levels{};
+      for (int component = 0; component < 256; component++) levels[component] = cubeLevel(static_cast<uint8_t>(component));
+      return levels;
+    }();
+
+    //Value of every level of the xterm color cube.
+    inline constexpr uint8_t cube_values[] = {0, 95, 135, 175, 215, 255};
+
+    //Distance between two colors, without the square root.
+    constexpr int colorDistance(int red1, int green1, int blue1, int red2, int green2, int blue2) {
+      return (red1 - red2) * (red1 - red2) + (green1 - green2) * (green1 - green2) + (blue1 - blue2) * (blue1 - blue2);
+    }
+
+    /**
+     * @brief Converts an RGB color to the closest color of the xterm 256 color palette.
+     * 
+     * The closest cube color and the closest grey of the ramp are compared, like tmux does.
+     * 
+     * @return The palette index, from 16 to 255.
+    */
+    constexpr uint8_t rgbToPalette(uint8_t red, uint8_t green, uint8_t blue) {
+      const int red_level = cube_levels[red], green_level = cube_levels[green], blue_level = cube_levels[blue];
+      const int cube_index = 16 + 36 * red_level + 6 * green_level + blue_level;
+      const int cube_distance = colorDistance(red, green, blue, cube_values[red_level], cube_values[green_level], cube_values[blue_level]);
+
+      const int average = (red + green + blue) / 3;
+      const int grey_index = average > 238 ? 23 : (average > 3 ? average - 3 : 0) / 10;
+      const int grey = 8 + 10 * grey_index;
+      const int grey_distance = colorDistance(red, green, blue, grey, grey, grey);
+
+      return static_cast<uint8_t>(grey_distance < cube_distance ? 232 + grey_index : cube_index);
+    }
+
+    //RGB values of the 16 standard colors in the default xterm palette, in the same order as the Color enum.
+    inline constexpr uint8_t basic_palette[16][3] = {
+      {0, 0, 0}, {205, 0, 0}, {0, 205, 0}, {205, 205, 0}, {0, 0, 238}, {205, 0, 205}, {0, 205, 205}, {229, 229, 229},
+      {127, 127, 127}, {255, 0, 0}, {0, 255, 0}, {255, 255, 0}, {92, 92, 255}, {255, 0, 255}, {0, 255, 255}, {255, 255, 255}
+    };
+
+    /**
+     * @brief Returns the RGB value of a color of the xterm 256 color palette.
+    */
+    constexpr std::array<uint8_t, 3> paletteValue(uint8_t index) {
+      if (index < 16) return {basic_palette[index][0], basic_palette[index][1], basic_palette[index][2]};
+      if (index >= 232) {
+        const uint8_t grey = static_cast<uint8_t>(8 + 10 * (index - 232));
+        return {grey, grey, grey};
+      }
+      const int cube = index - 16;
+      return {cube_values[cube / 36], cube_values[cube / 6 % 6], cube_values[cube % 6]};
+    }
+
+    //Maps every color of the xterm 256 color palette to the closest of the 16 standard colors.
+    inline constexpr std::array<Color, 256> palette_to_basic = [] {
+      std::array<Color, 256> colors{};
+      for (int index = 0; index < 256; index++) {
+        const std::array<uint8_t, 3> value = paletteValue(static_cast<uint8_t>(index));
+        int closest = 0;
+        int closest_distance = 1 << 30;
+        for (int candidate = 0; candidate < 16; candidate++) {
+          const int distance = colorDistance(value[0], value[1], value[2], basic_palette[candidate][0], basic_palette[candidate][1], basic_palette[candidate][2]);
+          if (distance < closest_distance) {
+            closest = candidate;
+            closest_distance = distance;
+          }
+        }
+        colors[index] = static_cast<Color>(index < 16 ? index : closest);
+      }
+      return colors;
+    }();
+
+    /**
+     * @brief Converts an RGB color to the closest of the 16 standard colors.
+    */
+    constexpr Color rgbToBasic(uint8_t red, uint8_t green, uint8_t blue) {
+      return palette_to_basic[rgbToPalette(red, green, blue)];
+    }
+
+    #ifdef CLISTYLE_SSE2
+    /**
+     * @brief Converts 8 RGB colors to the xterm 256 color palette with SSE2, with the same results as rgbToPalette.
+     * 
+     * @param red The red components, one for every 16 bit lane.
+     * @param green The green components, one for every 16 bit lane.
+     * @param blue The blue components, one for every 16 bit lane.
+     * 
+     * @return The 8 palette indexes, one for every 16 bit lane.
+    */
+    inline __m128i rgbToPalette(__m128i red, __m128i green, __m128i blue) {
+      const __m128i zero = _mm_setzero_si128();
+
+      //Cube level and cube value of every component
+      auto level = [&](__m128i component) {
+        const __m128i divided = _mm_mulhi_epu16(_mm_sub_epi16(component, _mm_set1_epi16(35)), _mm_set1_epi16(1639)); //(component - 35) / 40
+        const __m128i below_114 = _mm_cmplt_epi16(component, _mm_set1_epi16(114));
+        const __m128i below_48 = _mm_cmplt_epi16(component, _mm_set1_epi16(48));
+        const __m128i one_or_more = _mm_or_si128(_mm_and_si128(below_114, _mm_set1_epi16(1)), _mm_andnot_si128(below_114, divided));
+        return _mm_andnot_si128(below_48, one_or_more);
+      };
+      auto value = [&](__m128i cube_level) {
+        const __m128i is_zero = _mm_cmpeq_epi16(cube_level, zero);
+        return _mm_andnot_si128(is_zero, _mm_add_epi16(_mm_mullo_epi16(cube_level, _mm_set1_epi16(40)), _mm_set1_epi16(55)));
+      };
+      //Sum of the squared differences, as two vectors of 32 bit lanes
+      auto distance = [&](__m128i red_difference, __m128i green_difference, __m128i blue_difference, __m128i& low, __m128i& high) {
+        const __m128i red_green_low = _mm_unpacklo_epi16(red_difference, green_difference);
+        const __m128i red_green_high = _mm_unpackhi_epi16(red_difference, green_difference);
+        const __m128i blue_low = _mm_unpacklo_epi16(blue_difference, zero);
+        const __m128i blue_high = _mm_unpackhi_epi16(blue_difference, zero);
+        low = _mm_add_epi32(_mm_madd_epi16(red_green_low, red_green_low), _mm_madd_epi16(blue_low, blue_low));
+        high = _mm_add_epi32(_mm_madd_epi16(red_green_high, red_green_high), _mm_madd_epi16(blue_high, blue_high));
+      };
+
+      const __m128i red_level = level(red), green_level = level(green), blue_level = level(blue);
+      const __m128i cube_index = _mm_add_epi16(_mm_add_epi16(_mm_set1_epi16(16), _mm_mullo_epi16(red_level, _mm_set1_epi16(36))),
+                                               _mm_add_epi16(_mm_mullo_epi16(green_level, _mm_set1_epi16(6)), blue_level));
+      __m128i cube_low, cube_high;
+      distance(_mm_sub_epi16(red, value(red_level)), _mm_sub_epi16(green, value(green_level)), _mm_sub_epi16(blue, value(blue_level)), cube_low, cube_high);
+
+      const __m128i average = _mm_mulhi_epu16(_mm_add_epi16(_mm_add_epi16(red, green), blue), _mm_set1_epi16(21846)); //sum / 3
+      const __m128i above_238 = _mm_cmpgt_epi16(average, _mm_set1_epi16(238));
+      const __m128i ramp = _mm_mulhi_epu16(_mm_subs_epu16(average, _mm_set1_epi16(3)), _mm_set1_epi16(6554)); //(average - 3) / 10
+      const __m128i grey_index = _mm_or_si128(_mm_and_si128(above_238, _mm_set1_epi16(23)), _mm_andnot_si128(above_238, ramp));
+      const __m128i grey = _mm_add_epi16(_mm_mullo_epi16(grey_index, _mm_set1_epi16(10)), _mm_set1_epi16(8));
+      __m128i grey_low, grey_high;
+      distance(_mm_sub_epi16(red, grey), _mm_sub_epi16(green, grey), _mm_sub_epi16(blue, grey), grey_low, grey_high);
+
+      const __m128i use_grey = _mm_packs_epi32(_mm_cmplt_epi32(grey_low, cube_low), _mm_cmplt_epi32(grey_high, cube_high));
+      return _mm_or_si128(_mm_and_si128(use_grey, _mm_add_epi16(grey_index, _mm_set1_epi16(232))), _mm_andnot_si128(use_grey, cube_index));
+    }
+    #endif
+
+    //Length of the longest combined escape code: "\033[1;3;4;7;2;5;8;9;21;4:3;53;38;2;255;255;255;48;2;255;255;255;58;2;255;255;255m"
+    constexpr std::size_t STYLE_SEQUENCE_SIZE = 79;
+
+    /**
+     * @brief Appends the SGR parameters of a color, without the escape prefix and the final 'm'.
+     * 
+     * @param sequence The buffer to append to.
+     * @param kind The kind of the color.
+     * @param color The color index or the RGB components.
+     * @param base 30 for the text, 40 for the background or 50 for the underline.
+     * @param depth The color depth of the output, RGB colors are converted to the palette below truecolor.
+    */
+    template <std::size_t capacity>
+    constexpr void appendColor(FixedString<capacity>& sequence, Style::ColorKind kind, const uint8_t (&color)[3], uint8_t base, ColorDepth depth) {
+      if (kind == Style::ColorKind::named) {
+        sequence.appendNumber(static_cast<uint8_t>(base + color[0] % 8));
+      }
+      else if (kind == Style::ColorKind::palette) {
+        sequence.appendNumber(static_cast<uint8_t>(base + 8));
+        sequence.append(";5;");
+        sequence.appendNumber(color[0]);
+      }
+      else if (kind == Style::ColorKind::rgb && depth != ColorDepth::truecolor) {
+        sequence.appendNumber(static_cast<uint8_t>(base + 8));
+        sequence.append(";5;");
+        sequence.appendNumber(rgbToPalette(color[0], color[1], color[2]));
+      }
+      else if (kind == Style::ColorKind::rgb) {
+        sequence.appendNumber(static_cast<uint8_t>(base + 8));
+        sequence.append(";2;");
+        sequence.appendNumber(color[0]);
+        sequence.append(";");
+        sequence.appendNumber(color[1]);
+        sequence.append(";");
+        sequence.appendNumber(color[2]);
+      }
+    }
+
+    //Number of values in the Attribute enum.
+    constexpr uint8_t ATTRIBUTE_COUNT = 11;
+
+    //SGR parameters that turn each Attribute on and off, indexed like the Attribute enum.
+    //Some attributes share the code that turns them off: 22 for bold and dim, 24 for every underline.
+    inline constexpr std::string_view attribute_on_codes[ATTRIBUTE_COUNT] = {"1", "3", "4", "7", "2", "5", "8", "9", "21", "4:3", "53"};
+    inline constexpr std::string_view attribute_off_codes[ATTRIBUTE_COUNT] = {"22", "23", "24", "27", "22", "25", "28", "29", "24", "24", "55"};
+
+    /**
+     * @brief Returns the attribute bits that the terminal ends up showing for a style.
+     * 
+     * Bright named colors are emitted as bold plus the standard color, so they turn on the bold bit.
+     * Only one underline style can be shown, when more are set the last one in the Attribute enum is kept,
+     * which is the one left by their codes in makeStyle().
+     * 
+     * @param style The style to inspect.
+     * 
+     * @return One bit for every Attribute.
+    */
+    constexpr uint16_t renderedAttributes(const Style& style) {
+      const bool bright = (style.foregroundKind() == Style::ColorKind::named && style.foreground[0] >= 8) ||
+                          (style.backgroundKind() == Style::ColorKind::named && style.background[0] >= 8);
+      uint16_t attributes = static_cast<uint16_t>(style.attributes | (bright ? 1u : 0u));
+      const uint16_t underline = 1u << static_cast<uint8_t>(Attribute::underline);
+      const uint16_t double_underline = 1u << static_cast<uint8_t>(Attribute::double_underline);
+      const uint16_t curly_underline = 1u << static_cast<uint8_t>(Attribute::curly_underline);
+      if (attributes & curly_underline) attributes = static_cast<uint16_t>(attributes & ~(underline | double_underline));
+      else if (attributes & double_underline) attributes = static_cast<uint16_t>(attributes & ~underline);
+      return attributes;
+    }
+
+    /**
+     * @brief Checks if two colors produce the same SGR parameters.
+    */
+    constexpr bool sameColor(Style::ColorKind left_kind, const uint8_t (&left)[3], Style::ColorKind right_kind, const uint8_t (&right)[3]) {
+      if (left_kind != right_kind) return false;
+      if (left_kind == Style::ColorKind::named) return left[0] % 8 == right[0] % 8;
+      if (left_kind == Style::ColorKind::palette) return left[0] == right[0];
+      if (left_kind == Style::ColorKind::rgb) return left[0] == right[0] && left[1] == right[1] && left[2] == right[2];
+      return true;
+    }
+
+    /**
+     * @brief Converts the RGB and palette colors of a style to the standard colors when the output only has 16 colors.
+     * 
+     * The underline color is dropped, since it needs at least the 256 color palette.
+     * 
+     * @param style The style to convert.
+     * @param depth The color depth of the output.
+     * 
+     * @return The style that the output can show.
+    */
+    constexpr Style resolveStyle(Style style, ColorDepth depth) {
+      if (depth != ColorDepth::basic && depth != ColorDepth::none) return style;
+      if (style.foregroundKind() == Style::ColorKind::rgb) {
+        style = style | fg(rgbToBasic(style.foreground[0], style.foreground[1], style.foreground[2]));
+        style.foreground[1] = style.foreground[2] = 0;
+      }
+      if (style.backgroundKind() == Style::ColorKind::rgb) {
+        style = style | bg(rgbToBasic(style.background[0], style.background[1], style.background[2]));
+        style.background[1] = style.background[2] = 0;
+      }
+      if (style.foregroundKind() == Style::ColorKind::palette) style = style | fg(palette_to_basic[style.foreground[0]]);
+      if (style.backgroundKind() == Style::ColorKind::palette) style = style | bg(palette_to_basic[style.background[0]]);
+      style.underline_kind = 0;
+      style.underline[0] = style.underline[1] = style.underline[2] = 0;
+      return style;
+    }
+
+    /**
+     * @brief Builds the single escape code that applies every part of a style.
+     * 
+     * Bright colors are emitted like in the color tables, as bold plus the standard color.
+     * 
+     * @param target The style to encode.
+     * @param depth The color depth of the output, custom colors are converted to what it can show.
+     * 
+     * @return The escape code, empty when the style is empty.
+    */
+    constexpr FixedString<STYLE_SEQUENCE_SIZE> makeStyle(const Style& target, ColorDepth depth = ColorDepth::truecolor) {
+      const Style style = resolveStyle(target, depth);
+      FixedString<STYLE_SEQUENCE_SIZE> sequence;
+      if (style.empty()) return sequence;
+
+      const uint16_t attributes = renderedAttributes(style);
+      sequence.append("\033[");
+      for (uint8_t attribute = 0; attribute < ATTRIBUTE_COUNT; attribute++) {
+        if (!((attributes >> attribute) & 1u)) continue;
+        sequence.append(attribute_on_codes[attribute]);
+        sequence.append(";");
+      }
+      if (style.foregroundKind() != Style::ColorKind::none) {
+        appendColor(sequence, style.foregroundKind(), style.foreground, 30, depth);
+        sequence.append(";");
+      }
+      if (style.backgroundKind() != Style::ColorKind::none) {
+        appendColor(sequence, style.backgroundKind(), style.background, 40, depth);
+        sequence.append(";");
+      }
+      if (style.underlineKind() != Style::ColorKind::none) {
+        appendColor(sequence, style.underlineKind(), style.underline, 50, depth);
+        sequence.append(";");
+      }
+      sequence.data[sequence.length - 1] = 'm'; //replaces the last ';'
+      return sequence;
+    }
+
+    //Length of the longest escape code between two styles: "\033[22;23;24;27;25;28;29;2;21;4:3;53;38;2;255;255;255;48;2;255;255;255;58;2;255;255;255m"
+    constexpr std::size_t STYLE_DELTA_SIZE = 86;
+
+    /**
+     * @brief Builds the shortest escape code that changes the terminal from a style to another.
+     * 
+     * Only the parameters that differ are emitted, unless a full reset followed by the new style is shorter.
+     * When an off code also turns off an attribute that stays on, like 22 for bold and dim, that attribute is turned on again.
+     * 
+     * @param current The style currently applied.
+     * @param target The style to apply.
+     * @param depth The color depth of the output, custom colors are converted to what it can show.
+     * 
+     * @return The escape code, empty when both styles look the same.
+    */
+    constexpr FixedString<STYLE_DELTA_SIZE> makeStyleDelta(const Style& current, const Style& target, ColorDepth depth = ColorDepth::truecolor) {
+      const Style from = resolveStyle(current, depth);
+      const Style to = resolveStyle(target, depth);
+      FixedString<STYLE_DELTA_SIZE> delta;
+      const uint16_t from_attributes = renderedAttributes(from);
+      const uint16_t to_attributes = renderedAttributes(to);
+      const bool same_foreground = sameColor(from.foregroundKind(), from.foreground, to.foregroundKind(), to.foreground);
+      const bool same_background = sameColor(from.backgroundKind(), from.background, to.backgroundKind(), to.background);
+      const bool same_underline = sameColor(from.underlineKind(), from.underline, to.underlineKind(), to.underline);
+      if (from_attributes == to_attributes && same_foreground && same_background && same_underline) return delta;
+
+      if (to.empty()) {
+        delta.append(RESET_STYLE);
+        return delta;
+      }
+
+      delta.append("\033[");
+      uint16_t turned_off = 0; //Attributes turned off by the emitted off codes, including the ones that share them
+      for (uint8_t attribute = 0; attribute < ATTRIBUTE_COUNT; attribute++) {
+        const bool was_on = (from_attributes >> attribute) & 1u;
+        const bool is_on = (to_attributes >> attribute) & 1u;
+        if (!was_on || is_on || ((turned_off >> attribute) & 1u)) continue;
+        delta.append(attribute_off_codes[attribute]);
+        delta.append(";");
+        for (uint8_t shared = 0; shared < ATTRIBUTE_COUNT; shared++) {
+          if (attribute_off_codes[shared] == attribute_off_codes[attribute]) turned_off = static_cast<uint16_t>(turned_off | (1u << shared));
+        }
+      }
+      for (uint8_t attribute = 0; attribute < ATTRIBUTE_COUNT; attribute++) {
+        const bool was_on = ((from_attributes & ~turned_off) >> attribute) & 1u;
+        const bool is_on = (to_attributes >> attribute) & 1u;
+        if (!is_on || was_on) continue;
+        delta.append(attribute_on_codes[attribute]);
+        delta.append(";");
+      }
+      if (!same_foreground) {
+        if (to.foregroundKind() == Style::ColorKind::none) delta.append("39");
+        else appendColor(delta, to.foregroundKind(), to.foreground, 30, depth);
+        delta.append(";");
+      }
+      if (!same_background) {
+        if (to.backgroundKind() == Style::ColorKind::none) delta.append("49");
+        else appendColor(delta, to.backgroundKind(), to.background, 40, depth);
+        delta.append(";");
+      }
+      if (!same_underline) {
+        if (to.underlineKind() == Style::ColorKind::none) delta.append("59");
+        else appendColor(delta, to.underlineKind(), to.underline, 50, depth);
+        delta.append(";");
+      }
+      delta.data[delta.length - 1] = 'm'; //replaces the last ';'
+
+      const FixedString<STYLE_SEQUENCE_SIZE> full = makeStyle(to, depth);
+      if (full.length + 2 < delta.length) { //"\033[0;" plus the parameters of the full style
+        delta = FixedString<STYLE_DELTA_SIZE>();
+        delta.append("\033[0;");
+        delta.append(full.view().substr(2));
+      }
+      return delta;
+    }
+
+    //Number of iword slots used to store a Style, each slot holds 32 bits so it works where long is 32 bits too.
+    constexpr std::size_t STYLE_SLOTS = (sizeof(Style) + 3) / 4;
+
+    //Indexes returned by std::ios_base::xalloc, used to store the state of every stream.
+    struct StreamSlots {
+      int style[STYLE_SLOTS];
+      int flags;
+    };
+
+    //Bits stored in the flags slot of a stream, when none is set the detected capability of the output is used.
+    constexpr long STREAM_COLORS_DISABLED = 1;
+    constexpr long STREAM_COLORS_ENABLED = 2;
+
+    /**
+     * @brief Returns the iword indexes reserved by the library, allocated the first time it's called.
+    */
+    inline const StreamSlots& streamSlots() {
+      static const StreamSlots slots = [] {
+        StreamSlots allocated{};
+        for (int& slot : allocated.style) slot = std::ios_base::xalloc();
+        allocated.flags = std::ios_base::xalloc();
+        return allocated;
+      }();
+      return slots;
+    }
+
+    /**
+     * @brief Returns the style that was applied to a stream by the library functions.
+    */
+    inline Style streamStyle(std::ios_base& stream) {
+      uint32_t words[STYLE_SLOTS] = {};
+      for (std::size_t slot = 0; slot < STYLE_SLOTS; slot++) {
+        words[slot] = static_cast<uint32_t>(stream.iword(streamSlots().style[slot]));
+      }
+      Style style;
+      std::memcpy(&style, words, sizeof(Style));
+      return style;
+    }
+
+    /**
+     * @brief Stores the style that is applied to a stream.
+    */
+    inline void setStreamStyle(std::ios_base& stream, const Style& style) {
+      uint32_t words[STYLE_SLOTS] = {};
+      std::memcpy(words, &style, sizeof(Style));
+      for (std::size_t slot = 0; slot < STYLE_SLOTS; slot++) {
+        stream.iword(streamSlots().style[slot]) = static_cast<long>(words[slot]);
+      }
+    }
+
+    /**
+     * @brief Checks if the library is allowed to write escape codes to a stream.
+    */
+    inline bool streamColorsEnabled(std::ios_base& stream) {
+      const long flags = stream.iword(streamSlots().flags);
+      if (flags & STREAM_COLORS_DISABLED) return false;
+      return (flags & STREAM_COLORS_ENABLED) || streamColorDepth(stream) != ColorDepth::none;
+    }
+
+    /**
+     * @brief Returns the color depth used for the escape codes written to a stream.
+     * 
+     * Streams with the colors forced on use truecolor when their output was detected as not able to show colors.
+    */
+    inline ColorDepth streamDepth(std::ios_base& stream) {
+      const ColorDepth depth = streamColorDepth(stream);
+      return depth == ColorDepth::none ? ColorDepth::truecolor : depth;
+    }
+
+    /**
+     * @brief Adds a style to the one applied to the stream, writing the escape code only if something changes.
+     * 
+     * @param os The stream to apply the style to.
+     * @param change The style to add.
+     * @param code The escape code that applies the change.
+     * 
+     * @return The modified stream.
+    */
+    inline ostream& applyToStream(ostream& os, const Style& change, std::string_view code) {
+      if (!streamColorsEnabled(os)) return os;
+      const Style current = streamStyle(os);
+      Style next = current | change;
+      next.attributes = renderedAttributes(next);
+      if (next == current) return os;
+      setStreamStyle(os, next);
+      return os << code;
+    }
+
+    /**
+     * @brief Applies one of the standard or bright colors to the stream.
+     * 
+     * @param os The stream to apply the color to.
+     * @param position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+     * @param color The color to apply.
+     * 
+     * @return The modified stream.
+    */
+    inline ostream& applyColor(ostream& os, uint8_t position, Color color) {
+      if (position == 1) return applyToStream(os, fg(color), color_text[color]);
+      return applyToStream(os, bg(color), color_background[color]);
+    }
+
+    /**
+     * @brief Applies a text style to the stream.
+     * 
+     * @param os The stream to apply the style to.
+     * @param attribute The style to apply.
+     * 
+     * @return The modified stream.
+    */
+    inline ostream& applyAttribute(ostream& os, Attribute attribute) {
+      return applyToStream(os, attribute, styles[attribute]);
+    }
+
+    /**
+     * @brief Resets the stream to the default style, only if a style is applied.
+     * 
+     * @param os The stream to reset.
+     * 
+     * @return The modified stream.
+    */
+    inline ostream& resetStream(ostream& os) {
+      if (!streamColorsEnabled(os) || streamStyle(os).empty()) return os;
+      setStreamStyle(os, Style());
+      return os << RESET_STYLE;
+    }
+
+    //Stores one escape code for every RGB color used in the program, evaluated at compile time.
+    template <uint8_t position, uint8_t red, uint8_t green, uint8_t blue>
+    inline constexpr FixedString<RGB_SEQUENCE_SIZE> color_sequence = makeColor<position, red, green, blue>();
+
+    //Length of the longest palette escape code: "\033[38;5;255m"
+    constexpr std::size_t PALETTE_SEQUENCE_SIZE = 11;
+
+    /**
+     * @brief Builds at compile time the ANSI escape code for a color of the xterm 256 color palette.
+     * 
+     * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+     * @tparam index The index of the color in the palette (0-255).
+     * @return The escape code stored in a fixed-size buffer.
+    */
+    template <uint8_t position, uint8_t index>
+    constexpr FixedString<PALETTE_SEQUENCE_SIZE> makePaletteColor() {
+      FixedString<PALETTE_SEQUENCE_SIZE> sequence;
+      sequence.append(position == 1 ? "\033[38;5;" : "\033[48;5;");
+      sequence.appendNumber(index);
+      sequence.append("m");
+      return sequence;
+    }
+
+    //Stores one escape code for every palette color used in the program, evaluated at compile time.
+    template <uint8_t position, uint8_t index>
+    inline constexpr FixedString<PALETTE_SEQUENCE_SIZE> palette_sequence = makePaletteColor<position, index>();
+
+    /**
+     * @brief Returns the ANSI escape code for the background or for the text based on the position
+     * 
+     * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+     * @tparam red Red component of the color (0-255).
+     * @tparam green Green component of the color (0-255).
+     * @tparam blue Blue component of the color (0-255).
+     * @param depth The color depth of the output. Below truecolor the closest palette or standard color is used,
+     *              every version is computed at compile time.
+     * @return The ANSI escape code for the specified color either for the background or for the text.
+    */
+    template <uint8_t position, uint8_t red, uint8_t green, uint8_t blue>
+    constexpr std::string_view getColor(ColorDepth depth = ColorDepth::truecolor){
+      if (depth == ColorDepth::palette) return palette_sequence<position, rgbToPalette(red, green, blue)>.view();
+      if (depth == ColorDepth::basic) {
+        constexpr Color basic = rgbToBasic(red, green, blue);
+        return position == 1 ? color_text[basic] : color_background[basic];
+      }
+      return color_sequence<position, red, green, blue>.view();
+    }
+
+    /**
+     * @brief Returns the ANSI escape code of a palette color for the background or for the text based on the position
+     * 
+     * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+     * @tparam index The index of the color in the palette (0-255).
+     * @param depth The color depth of the output. With 16 colors the closest standard color is used,
+     *              every version is computed at compile time.
+     * @return The ANSI escape code for the specified color either for the background or for the text.
+    */
+    template <uint8_t position, uint8_t index>
+    constexpr std::string_view getPaletteColor(ColorDepth depth = ColorDepth::truecolor){
+      if (depth == ColorDepth::basic) {
+        constexpr Color basic = palette_to_basic[index];
+        return position == 1 ? color_text[basic] : color_background[basic];
+      }
+      return palette_sequence<position, index>.view();
+    }
+
+    /**
+     * @brief Applies a color to the given text based on the templates parameters
+     * 
+     * @tparam red Red component of the color (0-255).
+     * @tparam green Green component of the color (0-255).
+     * @tparam blue Blue component of the color (0-255).
+     * 
+     * @param text The text to color.
+     * 
+     * @return The colored text followed by the reset style.
+    */
+    template <uint8_t red, uint8_t green, uint8_t blue>
+    string colorText(const string& text) {
+      return buildStyled(getColor<1, red, green, blue>(outputDepth()), text);
+    }
+
+    /**
+     * @brief Applies a color to the given text based on the templates parameters
+     * 
+     * @tparam red Red component of the color (0-255).
+     * @tparam green Green component of the color (0-255).
+     * @tparam blue Blue component of the color (0-255).
+     * 
+     * @param text The text to color. Its buffer is reused for the returned string.
+     * 
+     * @return The colored text followed by the reset style.
+    */
+    template <uint8_t red, uint8_t green, uint8_t blue>
+    string colorText(string&& text) {
+      return buildStyled(getColor<1, red, green, blue>(outputDepth()), std::move(text));
+    }
+    
+    /**
+     * @brief Returns a color based on the templates parameters.
+     * 
+     * @tparam red Red component of the color (0-255).
+     * @tparam green Green component of the color (0-255).
+     * @tparam blue Blue component of the color (0-255).
+     * @return The color calculated from the temlate parameters.
+    */
+    template <uint8_t red, uint8_t green, uint8_t blue>
+    constexpr std::string_view colorText(ColorDepth depth = ColorDepth::truecolor) {
+      return getColor<1, red, green, blue>(depth);
+    }
+
+    /**
+     * @brief Applies a color for the background based on the templates parameters
+     * 
+     * @tparam red Red component of the color (0-255).
+     * @tparam green Green component of the color (0-255).
+     * @tparam blue Blue component of the color (0-255).
+     * 
+     * @param text The text to color.
+     * 
+     * @return The colored background followed by the reset style.
+    */
+    template <uint8_t red, uint8_t green, uint8_t blue>
+    string colorBackground(const string& text) {
+      return buildStyled(getColor<0, red, green, blue>(outputDepth()), text);
+    }
+
+    /**
+     * @brief Applies a color for the background based on the templates parameters
+     * 
+     * @tparam red Red component of the color (0-255).
+     * @tparam green Green component of the color (0-255).
+     * @tparam blue Blue component of the color (0-255).
+     * 
+     * @param text The text to color. Its buffer is reused for the returned string.
+     * 
+     * @return The colored background followed by the reset style.
+    */
+    template <uint8_t red, uint8_t green, uint8_t blue>
+    string colorBackground(string&& text) {
+      return buildStyled(getColor<0, red, green, blue>(outputDepth()), std::move(text));
+    }
+
+    /**
+     * @brief Returns a color for the background based on the templates parameters.
+     * 
+     * @tparam red Red component of the color (0-255).
+     * @tparam green Green component of the color (0-255).
+     * @tparam blue Blue component of the color (0-255).
+     * 
+     * @param text The text to color.
+     * 
+     * @return The colored text followed by the reset style.
+    */
+    template <uint8_t red, uint8_t green, uint8_t blue>
+    constexpr std::string_view colorBackground(ColorDepth depth = ColorDepth::truecolor) {
+      return getColor<0, red, green, blue>(depth);
+    }
+
+    /**
+     * @brief Check if a given position is equal to TEXT (1) or to BACKGROUND (0), otherwise throws an error
+    */
+    inline void checkPosition(uint8_t position){
+      if (position != 1 && position != 0){
+        std::cerr << "Position must be either 0 or 1";
+        exit(EXIT_FAILURE);
+      }
+    }
+
+    constexpr char ESCAPE = '\033';
+
+    //Terminal width of the code points, generated from the Unicode 14.0 character database:
+    //0 for controls, combining marks (Mn, Me), format characters (Cf, except the soft hyphen) and Hangul medial and final jamo,
+    //2 for the East Asian Wide and Fullwidth characters and for the planes 2 and 3, 1 for everything else.
+    //Index of the width block of every range of 128 code points, up to U+3FFFF.
+    inline constexpr uint8_t width_blocks[2048] = {
+      0,1,2,2,2,2,3,4,2,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,
+      28,29,30,31,32,33,34,35,2,2,2,2,2,36,37,38,39,40,41,42,43,44,45,46,47,48,2,49,2,2,50,51,
+      52,53,2,54,2,2,55,56,57,2,2,58,59,60,61,62,2,2,2,2,2,2,63,64,2,65,66,67,68,69,69,69,
+      70,71,69,69,72,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,73,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,74,2,2,75,76,2,77,78,79,80,81,82,83,84,85,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,86,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+      2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+      2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,69,69,69,69,87,88,2,2,2,89,90,91,92,93,
+      94,95,96,97,69,98,99,100,2,101,102,103,2,2,104,105,106,107,108,109,110,111,112,113,114,115,116,69,117,118,119,120,
+      121,122,123,124,125,126,127,69,128,129,69,130,131,132,133,69,134,135,136,137,138,139,69,69,140,141,142,143,69,144,69,145,
+      2,2,2,2,2,2,2,146,147,2,148,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,149,
+      2,2,2,2,2,2,2,2,150,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,2,2,2,2,151,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,2,2,2,2,152,153,154,155,69,69,69,69,73,156,157,158,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,159,160,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,161,148,
+      2,162,163,164,165,166,167,69,168,169,170,2,2,171,2,172,2,2,2,2,173,174,69,69,69,69,69,69,69,69,175,69,
+      176,69,177,69,69,178,69,69,69,69,69,69,69,69,69,179,2,180,181,69,69,69,69,69,182,183,184,69,185,186,69,69,
+      187,188,2,189,69,69,190,191,192,193,194,195,74,196,197,198,199,200,201,69,202,69,2,203,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+      69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69
+    };
+
+    //Width of every code point of a block, packed 2 bits per code point.
+    inline constexpr uint8_t width_values[204][32] = {
+      {0,0,0,0,0,0,0,0,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,21},
+      {0,0,0,0,0,0,0,0,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,85,90,85},
+      {170,85,149,89,85,85,85,85,101,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {21,0,80,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,86,85,85,85,85,85,85,85,85,149,86,85,85,85,85,85,85,85,85,85},
+      {85,85,149,86,2,0,0,0,0,0,0,0,0,0,0,16,65,16,170,170,85,85,85,85,85,85,149,106,85,169,170,170},
+      {0,80,85,85,0,0,64,84,85,85,85,85,85,85,85,85,85,85,21,0,0,0,0,0,85,85,85,85,84,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,5,0,16,0,20,4,80,85,85,85,85},
+      {85,85,85,37,81,85,85,85,85,85,85,85,0,0,0,0,0,0,128,86,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,5,0,0,164,170,170,170,85,85,85,85,85,85,85,85,85,85,21,0,0,85,149,82},
+      {85,85,85,85,85,5,16,0,0,1,1,160,85,85,85,149,85,85,85,85,85,85,1,154,85,85,149,170,85,85,85,85},
+      {85,85,85,149,160,170,0,0,85,85,85,85,85,85,85,85,85,85,5,0,0,0,0,0,0,0,0,0,0,0,0,0},
+      {64,85,85,85,85,85,85,85,85,85,85,85,85,85,69,84,1,0,84,81,1,0,85,85,5,85,85,85,85,85,85,85},
+      {81,86,85,105,105,85,85,85,85,85,89,85,153,90,165,84,1,104,105,145,170,106,170,101,5,90,85,85,85,85,85,133},
+      {66,86,149,106,105,85,85,85,85,85,89,85,89,150,165,88,129,42,40,160,162,170,86,153,170,90,85,85,80,145,170,170},
+      {66,86,85,101,101,85,85,85,85,85,89,85,89,86,165,84,1,32,100,161,169,170,170,170,5,90,85,85,165,170,6,0},
+      {82,86,85,105,105,85,85,85,85,85,89,85,89,86,165,20,1,104,105,161,170,66,170,101,5,90,85,85,85,85,170,170},
+      {74,86,149,90,89,165,150,89,106,169,149,90,85,85,165,90,148,90,89,161,169,106,170,170,170,90,85,85,85,85,149,170},
+      {84,84,85,89,89,85,85,85,85,85,89,85,85,85,165,4,84,9,8,160,170,130,149,166,5,90,85,85,170,106,85,85},
+      {81,85,85,89,89,85,85,85,85,85,89,85,85,86,165,20,85,73,89,160,170,150,170,150,5,90,85,85,150,170,170,170},
+      {80,85,85,89,89,85,85,85,85,85,85,85,85,85,21,84,1,88,89,81,170,85,85,85,5,90,85,85,85,85,85,85},
+      {82,86,85,85,85,149,90,85,85,85,85,85,101,85,85,166,85,149,138,106,5,136,85,85,170,90,85,85,90,169,170,170},
+      {86,85,85,85,85,85,85,85,85,85,85,85,81,0,128,106,85,21,0,64,85,85,85,170,170,170,170,170,170,170,170,170},
+      {150,89,149,85,85,85,85,85,85,102,85,85,81,0,0,164,85,153,0,160,85,85,165,85,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,80,85,85,85,85,85,85,17,81,85,85,85,86,85,85,85,85,85,85,85,85,169,2,0,0,64},
+      {0,4,85,1,0,0,2,0,0,0,0,0,0,0,0,88,85,69,85,89,85,85,149,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,1,4,0,65,65,85,85,85,85,85,85,80,5,84,85,85,85,1,84,85,85},
+      {69,65,85,81,85,85,85,81,85,85,85,85,85,85,85,85,85,101,170,166,85,85,85,85,85,85,85,85,85,85,85,85},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,0,0,0,0,0,0,0,0},
+      {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,89,165,85,149,89,165,85,85,85,85,85,85,85,85},
+      {85,85,89,165,85,85,85,85,85,85,85,85,89,165,85,149,89,165,85,85,85,149,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,89,165,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,2,85,85,85,85,85,85,85,169},
+      {85,85,85,85,85,85,165,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,165,85,165},
+      {85,85,85,85,85,85,85,169,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,169,170},
+      {85,85,85,85,5,164,170,106,85,85,85,85,5,149,170,170,85,85,85,85,5,170,170,170,85,85,85,89,9,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,16,0,80,85,69,1,0,0,85,85,161,85,85,165,170,85,85,165,170},
+      {85,85,21,0,85,85,165,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,169,170},
+      {85,65,85,85,85,85,85,85,85,85,145,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,165,170,170},
+      {85,85,85,85,85,85,85,149,64,21,84,170,69,85,1,170,169,85,85,85,85,85,85,85,85,85,85,165,85,169,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,170,85,85,85,85,85,85,165,170,85,85,149,90,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,21,20,90,85,85,85,85,85,85,85,85,85,85,85,85,85,69,0,128,68,1,0,84,21,0,0,40},
+      {85,85,165,170,85,85,165,170,85,85,85,165,0,0,0,0,0,0,0,128,170,170,170,170,170,170,170,170,170,170,170,170},
+      {0,85,85,85,85,85,85,85,85,85,85,85,85,4,64,84,69,85,85,169,85,85,85,85,85,85,21,0,0,85,85,149},
+      {80,85,85,85,85,85,85,85,5,80,16,80,85,85,85,85,85,85,85,85,85,85,85,85,85,69,80,17,80,170,170,85},
+      {85,85,85,85,85,85,85,85,85,85,85,0,0,5,106,85,85,85,165,86,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,169,170,85,85,85,85,85,85,85,85,85,85,149,86,85,85,170,170,64,0,0,0,4,0,84,81,85,84,144,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+      {85,85,85,85,85,165,85,165,85,85,85,85,85,85,85,85,85,165,85,165,85,85,102,102,85,85,85,85,85,85,85,165},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,89,85,85,85,89,85,85,85,90,85,86,85,85,85,85,90,89,85,149},
+      {85,85,21,0,85,85,85,85,85,85,5,64,85,85,85,85,85,85,85,85,85,85,85,85,0,8,0,0,165,85,85,85},
+      {85,85,85,149,85,85,85,169,85,85,85,85,85,85,85,85,169,170,170,170,0,0,0,0,0,0,0,0,168,170,170,170},
+      {85,85,85,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,165,85,85,85,105,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,169,86,150,85,85,85},
+      {85,85,85,85,85,85,85,85,85,149,170,170,170,170,170,170,85,85,149,170,170,170,170,170,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,105},
+      {85,85,85,85,85,90,85,85,85,85,85,85,85,85,85,85,85,85,170,170,170,85,85,85,85,85,85,85,85,85,85,149},
+      {85,85,85,85,149,85,85,85,89,85,165,85,85,85,85,105,85,90,85,101,85,86,85,85,85,85,101,85,165,89,101,89},
+      {85,89,165,85,85,85,85,85,85,85,86,85,85,85,85,85,85,85,85,102,149,154,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,169,85,85,85,85,85,85,86,85,85,149,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,149,86,85,85,85,85,85,85,85,85,85,85,85,85,86,89,85,85,85,85,85,85,85,90,85,85},
+      {85,85,85,85,85,101,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,21,80,170,86,85},
+      {85,85,85,85,85,85,85,85,85,101,170,166,85,85,85,85,85,85,85,85,85,85,85,85,85,85,170,106,169,170,170,42},
+      {85,85,85,85,85,149,170,170,85,149,85,149,85,149,85,149,85,149,85,149,85,149,85,149,0,0,0,0,0,0,0,0},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,165,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,170,170,10,160,170,170,170,106,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,130,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,85,85,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,170,170,170,170,170,85,85,85,85,85,85,85,85,85,85,85,21,64,0,0,80},
+      {85,85,85,85,85,85,85,5,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,80,85,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,101,86,165,170,170,170,170,170,90,85,85,85},
+      {69,69,21,85,85,85,85,85,85,65,85,168,85,85,165,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,160,170,90,85,85,165,170,0,0,0,0,80,85,85,21},
+      {85,85,85,85,85,85,85,85,85,5,0,80,85,85,85,85,85,21,0,0,80,170,170,106,170,170,170,170,170,170,170,170},
+      {64,85,85,85,85,85,85,85,85,85,85,85,21,5,80,80,85,85,85,101,85,85,165,90,85,81,85,85,85,85,85,149},
+      {85,85,85,85,85,85,85,85,85,85,1,64,65,129,170,170,21,85,85,164,85,85,165,85,85,85,85,85,85,85,85,84},
+      {85,85,85,85,85,85,85,85,85,85,85,85,4,20,84,5,145,170,170,170,170,170,106,85,85,85,85,80,85,133,170,170},
+      {86,149,86,149,86,149,170,170,85,149,85,149,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,170,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,81,84,161,85,85,165,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+      {85,149,170,170,106,85,170,70,85,85,85,85,85,149,85,153,101,89,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,170,170,106,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,90,85,85,85,85,85,85,85,85,85,85,85,85,85,170,106,170,170,170,170,170,170,170,170,85,85,85,85},
+      {0,0,0,0,170,170,170,170,0,0,0,0,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,85,89,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,41},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,86,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,90,85,90,85,90,85,90,169,170,170,85,149,170,170,2,165},
+      {85,85,85,86,85,85,85,85,85,149,85,85,85,85,149,101,85,85,85,165,85,85,85,165,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170},
+      {149,106,85,85,85,85,85,85,85,85,85,85,85,106,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,149,85,85,85,169,169,170,170,170,170,170,170,170,170,170,170,170,85,85,85,85,85,85,85,85,85,85,85,161},
+      {85,85,85,85,85,85,85,169,85,85,85,85,85,85,85,85,85,85,85,85,169,170,170,170,84,85,85,85,85,85,85,170},
+      {85,85,85,85,85,85,85,85,85,170,170,86,85,85,85,85,85,85,149,170,85,85,85,85,85,85,85,85,85,5,128,170},
+      {85,85,85,85,85,85,85,101,85,85,85,85,85,85,85,85,85,170,85,85,85,165,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,165,85,85,165,170,85,85,85,85,85,85,85,85,85,170,85,85,85,85,85,85,85,85,85,170},
+      {85,85,85,85,85,85,85,85,85,85,170,170,85,85,85,85,85,85,85,85,85,85,85,85,85,170,170,106,85,85,149,85},
+      {85,85,149,85,149,101,85,85,101,85,85,85,101,85,101,169,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,170,85,85,85,85,85,165,170,170,85,85,170,170,170,170,170,170},
+      {85,101,85,85,85,85,85,85,85,85,85,85,89,85,149,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,165,89,85,85,85,85,85,85,85,85,85,85,101,169,105,85,85,85,85,85,101,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,149,170,106,85,85,170,170,170,170,170,170,170,170,170,170,170,170,85,85,85,85,149,165,106,85},
+      {85,85,85,85,85,85,85,106,85,85,85,85,85,85,165,106,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,170,85,85,85,85,85,90,85,85,85,85,85,85,85,85,85,85,85},
+      {1,130,170,0,85,86,86,85,85,85,85,85,85,165,128,42,85,85,169,170,85,85,169,170,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,170,170,170,170,170,170,170,170,85,85,85,85,85,85,85,85,85,129,106,85,85,149,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,165,86,85,85,85,85,85,85,165,85,85,85,85,85,85,149,170,85,85},
+      {85,85,85,85,165,170,86,169,170,170,86,85,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,169,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,149,170,170,170,85,85,85,85,85,85,85,85,85,85,85,85,149,170,90,85},
+      {85,85,85,85,85,85,85,85,85,0,170,170,85,85,165,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,85,85,85,85,85,85,85,149},
+      {85,85,85,85,85,85,85,85,85,85,37,164,165,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,170,170,85,85,85,85,85,5,0,0,84,85,165,170,170,170,170,170,85,85,85,85},
+      {5,80,165,170,170,170,170,170,170,170,170,170,85,85,85,85,85,85,85,170,170,170,170,170,85,85,85,85,85,149,170,170},
+      {81,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,0,64,85,165,90,85,85,85,85,85,85,85,20,164,170,42},
+      {80,85,85,85,85,85,85,85,85,85,85,85,21,64,65,81,133,170,170,162,85,85,85,85,85,85,169,170,85,85,165,170},
+      {64,85,85,85,85,85,85,85,85,21,0,1,0,88,85,85,85,85,170,170,85,85,85,85,85,85,85,85,21,149,170,170},
+      {80,85,85,85,85,85,85,85,85,85,85,85,85,5,0,64,85,85,1,20,85,85,85,85,86,85,85,85,85,169,170,170},
+      {85,85,85,85,101,85,85,85,85,85,85,21,80,4,85,133,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,149,89,101,85,85,85,101,85,85,165,170,85,85,85,85,85,85,85,85,85,85,85,21,21,0,128,170,85,85,165,170},
+      {80,86,85,105,105,85,85,85,85,85,89,85,89,86,37,84,84,105,105,165,169,106,170,86,85,10,0,168,0,168,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,0,5,68,85,85,85,85,85,70,165,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,21,0,68,21,4,85,170,170,85,85,165,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,5,160,85,16,84,85,85,85,85,85,85,160,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,21,0,64,17,84,169,170,170,85,85,165,170,85,85,85,169,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,21,81,0,16,165,170,85,85,165,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,149,2,5,16,0,170,85,85,85,85,85,149,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,21,0,0,65,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,170,106},
+      {85,149,166,85,85,150,85,85,85,85,85,85,85,101,41,68,21,149,170,170,85,85,165,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,85,85,90,85,85,85,85,85,85,85,85,85,85,0,10,85,84,169,170,170,170,170,170,170},
+      {1,0,64,85,85,85,85,85,85,85,85,85,21,0,20,64,85,21,170,170,1,64,1,85,85,85,85,85,85,85,85,85},
+      {85,85,5,0,0,64,80,85,149,170,170,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,169,170},
+      {85,85,89,85,85,85,85,85,85,85,85,85,0,128,0,16,85,165,170,170,85,85,85,85,85,85,85,169,85,85,85,85},
+      {85,85,85,85,10,0,0,0,0,0,6,0,4,129,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,149,101,85,85,85,85,85,85,85,85,85,1,128,138,32,0,16,170,170,85,85,165,170,85,101,89,85,85,85,85,85},
+      {85,85,85,149,96,17,169,170,85,85,165,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,85,85,85,85,21,84,169,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,169,170,170,170,85,85,85,85,85,85,85,85,85,85,85,85,165,170,170,106},
+      {85,85,85,85,85,85,165,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,85,169,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,149,0,0,168,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,169,170,85,85,85,85,85,85,85,149,85,85,165,90,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,85,85,165,170,85,85,85,85,85,85,85,165,0,164,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,0,64,85,85,85,165,170,170,85,85,101,85,101,85,85,85,85,85,170,86},
+      {85,85,85,85,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,149,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,42,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,170,42,64,85,85,85,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,168,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,85,85,85,169},
+      {85,85,169,170,85,85,165,65,0,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {0,0,0,0,0,0,0,0,0,0,0,160,0,0,0,0,0,128,170,170,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,165,170,170},
+      {85,85,85,85,85,85,85,85,85,149,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,21,80,85,21,0,0,0},
+      {64,1,0,85,85,85,85,85,85,85,5,80,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,5,164,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,85,85,85,85,85,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,170,85,85,85,85,85,85,169,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,89,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,89,154,150,86,89,85,85,101,86,85,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,101,149,86,85,89,85,89,85,85,85,85,85,85,101,149,85,153,90,85,89,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,165,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,90,85,85,85,85,85,85,85,85,85,85,85,85},
+      {0,0,0,0,0,0,0,0,0,0,0,0,0,64,21,0,0,0,0,0,0,0,0,0,0,0,0,84,85,81,85,85},
+      {85,84,85,170,170,170,42,0,2,0,0,0,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,149,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {0,128,0,0,0,0,40,0,32,8,128,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,169,0,64,85,165,85,85,165,90,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,85,85,85,85,85,85,85,133,170,170,170,170,85,85,85,85,85,85,85,85,85,85,85,0,85,85,165,106},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,85,149,85,150,85,85,85,149},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,105,85,85,0,128,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,64,170,85,85,165,90,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,86,85,85,85},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,169,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,165,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,86,85,85,85,85,85,85,150,105,86,85,149,85,102,170,154,106,102,86,150,105,102,102,150,105,149,85,149,85,86,153},
+      {85,85,101,85,85,85,85,170,86,86,101,85,85,85,85,170,170,170,170,170,170,170,170,170,170,170,170,170,165,170,170,170},
+      {85,86,85,85,85,85,85,85,85,85,85,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+      {85,85,85,85,85,170,170,170,85,85,85,149,86,85,85,85,86,85,85,149,86,85,85,85,85,85,85,85,85,165,170,170},
+      {85,85,85,101,169,170,106,85,85,85,85,165,170,170,170,170,170,170,170,170,170,170,170,170,170,90,85,85,85,85,85,85},
+      {170,170,170,170,170,170,170,170,86,85,85,169,170,154,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,166},
+      {170,170,170,170,170,85,85,85,170,170,170,170,170,170,170,170,170,170,106,149,170,85,85,85,170,170,170,170,86,86,170,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,106,166,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,150},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,90,85,85,149,106,170,170,170,170,170,170,85,85,85,85,101,85},
+      {85,85,85,85,85,105,85,85,85,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170},
+      {170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,90,85,86,106,169,170,170,85,85,149,170,85,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,169,170,170,170,170,170,170,170,170,170},
+      {85,85,85,170,85,85,85,85,85,85,85,85,85,85,85,85,85,85,170,170,85,85,165,170,85,85,85,85,85,85,85,85},
+      {85,85,170,170,85,85,85,85,85,85,85,165,165,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,170,170,170,170,170,170,170,170,170,170,170,106,170,170,154,170,170,170,170,170,170,170,170,170,170,170,170,170,170},
+      {85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,170,170,170,85,85,85,165,170,170,170,170},
+      {85,85,85,85,149,85,85,85,85,85,85,85,85,85,85,85,85,85,149,170,170,170,170,170,170,170,170,170,85,85,165,170}
+    };
+
+    /**
+     * @brief Returns how many terminal columns a code point takes.
+     * 
+     * @param codepoint The code point to measure.
+     * 
+     * @return 0, 1 or 2.
+    */
+    inline std::size_t codepointWidth(char32_t codepoint) {
+      if (codepoint < 0x40000) {
+        const uint8_t packed = width_values[width_blocks[codepoint >> 7]][(codepoint & 127) >> 2];
+        return (packed >> ((codepoint & 3) * 2)) & 3u;
+      }
+      if (codepoint >= 0xE0000 && codepoint <= 0xE0FFF) return 0; //tags and variation selectors
+      return 1;
+    }
+
+    /**
+     * @brief Decodes the UTF-8 character that starts at the given position.
+     * 
+     * Invalid or truncated sequences are decoded as U+FFFD, one byte at a time.
+     * 
+     * @param position The position of the character, moved after it.
+     * @param end The end of the text.
+     * 
+     * @return The decoded code point.
+    */
+    inline char32_t decodeUtf8(const char*& position, const char* end) {
+      const unsigned char lead = static_cast<unsigned char>(*position);
+      const std::size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+      if (length == 0 || static_cast<std::size_t>(end - position) < length) {
+        position++;
+        return 0xFFFD;
+      }
+      char32_t codepoint = length == 1 ? lead : lead & (0x7F >> length);
+      for (std::size_t index = 1; index < length; index++) {
+        const unsigned char byte = static_cast<unsigned char>(position[index]);
+        if ((byte & 0xC0) != 0x80) {
+          position++;
+          return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (byte & 0x3F);
+      }
+      position += length;
+      return codepoint;
+    }
+
+    /**
+     * @brief Applies the parameters of an SGR sequence (the part between "\033[" and "m") to a style.
+     * 
+     * It understands every parameter written by this library, the bright colors 90-97 and 100-107,
+     * the 38;5;n and 48;5;n palette colors, and the sub-parameters separated by ':' like 4:3 and 38:2::r:g:b.
+     * 
+     * @param style The style to modify.
+     * @param parameters The parameters separated by ';' or ':', an empty parameter means 0.
+    */
+    inline void applySgr(Style& style, std::string_view parameters) {
+      constexpr std::size_t MAX_VALUES = 48;
+      int values[MAX_VALUES];
+      bool sub[MAX_VALUES]; //True when the value follows a ':', so it belongs to the parameter before it
+      std::size_t count = 0;
+      int value = 0;
+      bool after_colon = false;
+      for (std::size_t index = 0; index <= parameters.size(); index++) {
+        if (index == parameters.size() || parameters[index] == ';' || parameters[index] == ':') {
+          if (count < MAX_VALUES) {
+            values[count] = value;
+            sub[count++] = after_colon;
+          }
+          value = 0;
+          after_colon = index != parameters.size() && parameters[index] == ':';
+        }
+        else if (parameters[index] >= '0' && parameters[index] <= '9') {
+          value = value * 10 + (parameters[index] - '0');
+          if (value > 0xFFFF) value = 0xFFFF;
+        }
+      }
+
+      auto setAttribute = [&](Attribute attribute, bool enabled) {
+        const uint16_t bit = static_cast<uint16_t>(1u << static_cast<uint8_t>(attribute));
+        style.attributes = static_cast<uint16_t>(enabled ? style.attributes | bit : style.attributes & ~bit);
+      };
+      auto clearUnderline = [&]() {
+        setAttribute(Attribute::underline, false);
+        setAttribute(Attribute::double_underline, false);
+        setAttribute(Attribute::curly_underline, false);
+      };
+      //The underline styles replace each other, like on the terminal.
+      auto setUnderline = [&](Attribute attribute) {
+        clearUnderline();
+        setAttribute(attribute, true);
+      };
+      //Clears the kind and the components too, so the style compares equal to one that never had the color.
+      auto clearColor = [&](int base) {
+        uint8_t* color = style.underline;
+        if (base == 30) {
+          style.kinds = static_cast<uint8_t>(style.kinds & 0xF0);
+          color = style.foreground;
+        }
+        else if (base == 40) {
+          style.kinds = static_cast<uint8_t>(style.kinds & 0x0F);
+          color = style.background;
+        }
+        else style.underline_kind = 0;
+        color[0] = color[1] = color[2] = 0;
+      };
+
+      for (std::size_t index = 0; index < count; index++) {
+        const int code = values[index];
+        std::size_t subs = 0; //Number of sub-parameters of this parameter
+        while (index + subs + 1 < count && sub[index + subs + 1]) subs++;
+
+        if (code == 4 && subs != 0) {
+          const int kind = values[index + 1];
+          if (kind == 0) clearUnderline();
+          else setUnderline(kind == 2 ? Attribute::double_underline : kind == 3 ? Attribute::curly_underline : Attribute::underline);
+        }
+        else if ((code == 38 || code == 48 || code == 58) && subs != 0) {
+          const int base = code - 8;
+          const int mode = values[index + 1];
+          Style color;
+          if (mode == 2 && subs >= 4) {
+            const std::size_t first = index + subs - 2; //38:2:r:g:b or 38:2:colorspace:r:g:b
+            const uint8_t red = static_cast<uint8_t>(values[first]), green = static_cast<uint8_t>(values[first + 1]), blue = static_cast<uint8_t>(values[first + 2]);
+            color = base == 30 ? fg(red, green, blue) : base == 40 ? bg(red, green, blue) : ul(red, green, blue);
+          }
+          else if (mode == 5 && subs >= 2) {
+            const uint8_t palette_index = static_cast<uint8_t>(values[index + 2]);
+            color = base == 30 ? fg256(palette_index) : base == 40 ? bg256(palette_index) : ul256(palette_index);
+          }
+          style = style | color;
+        }
+        else if (code == 38 || code == 48 || code == 58) {
+          const int base = code - 8;
+          Style color;
+          if (index + 1 < count && values[index + 1] == 2 && index + 4 < count) {
+            const uint8_t red = static_cast<uint8_t>(values[index + 2]), green = static_cast<uint8_t>(values[index + 3]), blue = static_cast<uint8_t>(values[index + 4]);
+            color = base == 30 ? fg(red, green, blue) : base == 40 ? bg(red, green, blue) : ul(red, green, blue);
+            subs = 4;
+          }
+          else if (index + 1 < count && values[index + 1] == 5 && index + 2 < count) {
+            const uint8_t palette_index = static_cast<uint8_t>(values[index + 2]);
+            color = base == 30 ? fg256(palette_index) : base == 40 ? bg256(palette_index) : ul256(palette_index);
+            subs = 2;
+          }
+          else {
+            subs = count; //unknown color format, the rest of the sequence can't be read
+          }
+          style = style | color;
+        }
+        else if (code == 0) style = Style();
+        else if (code == 1) setAttribute(Attribute::bold, true);
+        else if (code == 2) setAttribute(Attribute::dim, true);
+        else if (code == 3) setAttribute(Attribute::italic, true);
+        else if (code == 4) setUnderline(Attribute::underline);
+        else if (code == 5 || code == 6) setAttribute(Attribute::blink, true);
+        else if (code == 7) setAttribute(Attribute::reverse, true);
+        else if (code == 8) setAttribute(Attribute::conceal, true);
+        else if (code == 9) setAttribute(Attribute::strikethrough, true);
+        else if (code == 21) setUnderline(Attribute::double_underline);
+        else if (code == 22) {
+          setAttribute(Attribute::bold, false);
+          setAttribute(Attribute::dim, false);
+        }
+        else if (code == 23) setAttribute(Attribute::italic, false);
+        else if (code == 24) clearUnderline();
+        else if (code == 25) setAttribute(Attribute::blink, false);
+        else if (code == 27) setAttribute(Attribute::reverse, false);
+        else if (code == 28) setAttribute(Attribute::conceal, false);
+        else if (code == 29) setAttribute(Attribute::strikethrough, false);
+        else if (code == 53) setAttribute(Attribute::overline, true);
+        else if (code == 55) setAttribute(Attribute::overline, false);
+        else if (code >= 30 && code <= 37) style = style | fg(static_cast<Color>(code - 30));
+        else if (code >= 40 && code <= 47) style = style | bg(static_cast<Color>(code - 40));
+        else if (code >= 90 && code <= 97) style = style | fg(static_cast<Color>(code - 90 + 8));
+        else if (code >= 100 && code <= 107) style = style | bg(static_cast<Color>(code - 100 + 8));
+        else if (code == 39) clearColor(30);
+        else if (code == 49) clearColor(40);
+        else if (code == 59) clearColor(50);
+        index += subs;
+      }
+    }
+
+    //Returns the index of the lowest set bit, the mask must not be 0.
+    inline unsigned countTrailingZeros(unsigned mask) {
+      #ifdef _MSC_VER
+      unsigned long first;
+      _BitScanForward(&first, mask);
+      return static_cast<unsigned>(first);
+      #else
+      return static_cast<unsigned>(__builtin_ctz(mask));
+      #endif
+    }
+
+    /**
+     * @brief Finds the first escape character in a range, 32 or 16 bytes at a time with AVX2 or SSE2 when available.
+     * 
+     * @param begin The start of the range.
+     * @param end The end of the range.
+     * 
+     * @return A pointer to the escape character, or end when there is none.
+    */
+    inline const char* findEscape(const char* begin, const char* end) {
+      #ifdef __AVX2__
+      const __m256i escape_wide = _mm256_set1_epi8(ESCAPE);
+      for (; end - begin >= 32; begin += 32) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+        const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, escape_wide)));
+        if (mask != 0) return begin + countTrailingZeros(mask);
+      }
+      #endif
+      #ifdef CLISTYLE_SSE2
+      const __m128i escape = _mm_set1_epi8(ESCAPE);
+      for (; end - begin >= 16; begin += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, escape)));
+        if (mask != 0) return begin + countTrailingZeros(mask);
+      }
+      #endif
+      for (; begin != end; begin++) {
+        if (*begin == ESCAPE) return begin;
+      }
+      return end;
+    }
+
+    /**
+     * @brief Measures the escape sequence that starts at the given position.
+     * 
+     * It recognizes CSI sequences (like the SGR ones written by this library), OSC and the other string
+     * sequences terminated by BEL or ST, and the short two or three byte escapes.
+     * A sequence cut at the end of the range is measured up to the end.
+     * 
+     * @param begin The position of the escape character.
+     * @param end The end of the range.
+     * 
+     * @return The length of the escape sequence, at least 1.
+    */
+    inline std::size_t escapeLength(const char* begin, const char* end) {
+      const char* position = begin + 1;
+      if (position == end) return 1;
+
+      const unsigned char introducer = static_cast<unsigned char>(*position++);
+      if (introducer == '[') { //CSI: parameters, intermediates and a final byte
+        while (position != end) {
+          const unsigned char byte = static_cast<unsigned char>(*position);
+          if (byte >= 0x40 && byte <= 0x7E) return static_cast<std::size_t>(position - begin + 1);
+          if (byte < 0x20 || byte > 0x3F) break; //malformed, the sequence ends before this byte
+          position++;
+        }
+        return static_cast<std::size_t>(position - begin);
+      }
+      if (introducer == ']' || introducer == 'P' || introducer == 'X' || introducer == '^' || introducer == '_') { //terminated by BEL or ST
+        for (; position != end; position++) {
+          if (*position == '\a') return static_cast<std::size_t>(position - begin + 1);
+          if (*position == ESCAPE && position + 1 != end && position[1] == '\\') return static_cast<std::size_t>(position - begin + 2);
+        }
+        return static_cast<std::size_t>(end - begin);
+      }
+      if (introducer >= 0x20 && introducer <= 0x2F) { //intermediates followed by a final byte, like ESC ( B
+        while (position != end && static_cast<unsigned char>(*position) >= 0x20 && static_cast<unsigned char>(*position) <= 0x2F) position++;
+        if (position != end) position++;
+        return static_cast<std::size_t>(position - begin);
+      }
+      return 2;
+    }
+
+    #ifdef CLISTYLE_SSE2
+    /**
+     * @brief Counts how many printable ASCII characters start the 16 bytes at the given position.
+    */
+    inline unsigned countPrintable(const char* position) {
+      const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+      //Bytes from 0x80 are negative as signed, so they fail the first comparison
+      const __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(0x1F)), _mm_cmplt_epi8(chunk, _mm_set1_epi8(0x7F)));
+      const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(printable));
+      return mask == 0xFFFF ? 16 : countTrailingZeros(~mask);
+    }
+    #endif
+
+    /**
+     * @brief Appends the styled text cut to a number of columns, keeping its escape sequences whole.
+     * 
+     * A wide character that doesn't fit is left out and the reset style is added when the text was cut after a style.
+     * 
+     * @param out The string to append to.
+     * @param text The styled text to cut.
+     * @param columns The maximum number of columns to keep.
+     * 
+     * @return The number of columns appended.
+    */
+    inline std::size_t appendTruncated(string& out, std::string_view text, std::size_t columns) {
+      std::size_t width = 0;
+      bool styled = false;
+      const char* position = text.data();
+      const char* const end = position + text.size();
+      while (position != end) {
+        const char* next = position;
+        std::size_t character_width = 0;
+        if (*position == ESCAPE) next += escapeLength(position, end);
+        else {
+          const unsigned char byte = static_cast<unsigned char>(*position);
+          if (byte < 0x80) {
+            character_width = (byte >= 0x20 && byte != 0x7F) ? 1 : 0;
+            next++;
+          }
+          else character_width = codepointWidth(decodeUtf8(next, end));
+        }
+        if (width + character_width > columns) {
+          if (styled) out.append(RESET_STYLE);
+          return width;
+        }
+        if (*position == ESCAPE) styled = true;
+        out.append(position, static_cast<std::size_t>(next - position));
+        width += character_width;
+        position = next;
+      }
+      return width;
+    }
+
+    /**
+     * @brief Writes a whole buffer to a file descriptor, retrying after partial writes and interruptions.
+     * 
+     * @param fd The file descriptor to write to.
+     * @param data The bytes to write.
+     * @param size The number of bytes.
+     * 
+     * @return False when the descriptor reported an error.
+    */
+    inline bool writeAll(int fd, const char* data, std::size_t size) {
+      while (size != 0) {
+        #ifdef _WIN32
+        const int written = _write(fd, data, static_cast<unsigned>(size > 0x7FFFFFFF ? 0x7FFFFFFF : size));
+        #else
+        const ssize_t written = ::write(fd, data, size);
+        #endif
+        if (written < 0) {
+          if (errno == EINTR) continue;
+          return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+      }
+      return true;
+    }
+
+    #ifdef _WIN32
+    //Same layout as the POSIX iovec, the parts are written one after another since Windows has no writev.
+    struct IoVector {
+      void* iov_base;
+      std::size_t iov_len;
+    };
+
+    constexpr std::size_t MAX_IO_VECTORS = 1024;
+    #else
+    using IoVector = ::iovec;
+
+    #ifdef IOV_MAX
+    constexpr std::size_t MAX_IO_VECTORS = IOV_MAX;
+    #else
+    constexpr std::size_t MAX_IO_VECTORS = 1024;
+    #endif
+    #endif
+
+    /**
+     * @brief Writes many buffers to a file descriptor with as few writev calls as possible, retrying after partial writes.
+     * 
+     * @param fd The file descriptor to write to.
+     * @param parts The buffers to write, modified to skip what was already written.
+     * @param count The number of buffers.
+     * 
+     * @return False when the descriptor reported an error.
+    */
+    inline bool writeVectors(int fd, IoVector* parts, std::size_t count) {
+      #ifdef _WIN32
+      for (std::size_t index = 0; index < count; index++) {
+        if (!writeAll(fd, static_cast<const char*>(parts[index].iov_base), parts[index].iov_len)) return false;
+      }
+      return true;
+      #else
+      while (count != 0) {
+        const ssize_t written = ::writev(fd, parts, static_cast<int>(count < MAX_IO_VECTORS ? count : MAX_IO_VECTORS));
+        if (written < 0) {
+          if (errno == EINTR) continue;
+          return false;
+        }
+        std::size_t remaining = static_cast<std::size_t>(written);
+        while (count != 0 && remaining >= parts->iov_len) {
+          remaining -= parts->iov_len;
+          parts++;
+          count--;
+        }
+        if (count != 0) {
+          parts->iov_base = static_cast<char*>(parts->iov_base) + remaining;
+          parts->iov_len -= remaining;
+        }
+      }
+      return true;
+      #endif
+    }
+
+    //Largest write that never mixes with writes of other threads, PIPE_BUF for pipes.
+    #ifdef PIPE_BUF
+    constexpr std::size_t ATOMIC_WRITE_SIZE = PIPE_BUF;
+    #else
+    constexpr std::size_t ATOMIC_WRITE_SIZE = 512;
+    #endif
+
+    //Returns the buffer where the thread stages its styled lines, reused for every line.
+    inline string& lineStaging() {
+      thread_local string buffer = [] {
+        string reserved;
+        reserved.reserve(ATOMIC_WRITE_SIZE);
+        return reserved;
+      }();
+      return buffer;
+    }
+
+    /**
+     * @brief Keeps the lines too large to be written atomically from mixing with any other line.
+     * 
+     * A short line only announces itself in the counter and is written without locking, unless a large line is pending:
+     * then it waits on the mutex like the large lines, which start writing once the announced short lines are done.
+    */
+    struct LineGate {
+      std::mutex mutex;
+      std::atomic<bool> large_pending{false};
+      std::atomic<std::size_t> short_writers{0};
+
+      template <typename Send>
+      bool write(std::size_t size, Send send) {
+        if (size <= ATOMIC_WRITE_SIZE) {
+          short_writers.fetch_add(1);
+          if (!large_pending.load()) {
+            const bool written = send();
+            short_writers.fetch_sub(1);
+            return written;
+          }
+          short_writers.fetch_sub(1);
+          std::lock_guard<std::mutex> lock(mutex);
+          return send();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        large_pending.store(true);
+        while (short_writers.load() != 0) std::this_thread::yield();
+        const bool written = send();
+        large_pending.store(false);
+        return written;
+      }
+    };
+
+    inline LineGate& lineGate() {
+      static LineGate gate;
+      return gate;
+    }
+
+    #ifdef CLISTYLE_IO_URING
+    /**
+     * @brief Sends the two buffers of a Writer through io_uring, one write in flight at a time so the output keeps its order.
+     * 
+     * The buffers are registered with the kernel when it allows it, otherwise plain writes are submitted.
+     * When the ring can't be set up the queue stays unavailable and the Writer uses write(2).
+    */
+    class UringQueue {
+    public:
+      UringQueue() = default;
+      UringQueue(const UringQueue&) = delete;
+      UringQueue& operator=(const UringQueue&) = delete;
+
+      ~UringQueue() {
+        if (ring_fd < 0) return;
+        wait();
+        close();
+      }
+
+      /**
+       * @brief Sets up a ring of 2 entries and registers the buffers.
+       * 
+       * @return False when the kernel has no io_uring, refuses it or can't write at the current file position.
+      */
+      bool open(char* first, char* second, std::size_t size) {
+        io_uring_params params{};
+        ring_fd = static_cast<int>(::syscall(__NR_io_uring_setup, 2, &params));
+        if (ring_fd < 0) return false;
+        if (!(params.features & IORING_FEAT_RW_CUR_POS)) return close();
+
+        sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) sq_size = cq_size = std::max(sq_size, cq_size);
+        sq_ring = ::mmap(nullptr, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+        if (sq_ring == MAP_FAILED) return close();
+        cq_ring = (params.features & IORING_FEAT_SINGLE_MMAP) ? sq_ring
+          : ::mmap(nullptr, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+        if (cq_ring == MAP_FAILED) return close();
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) return close();
+
+        char* sq = static_cast<char*>(sq_ring);
+        char* cq = static_cast<char*>(cq_ring);
+        sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        ::iovec buffers[2] = {{first, size}, {second, size}};
+        fixed = ::syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_BUFFERS, buffers, 2) == 0;
+        return true;
+      }
+
+      bool available() const {
+        return ring_fd >= 0;
+      }
+
+      /**
+       * @brief Queues the write of one of the registered buffers, after the write in flight is done.
+       * 
+       * When the kernel doesn't take the write, the buffer is written with write(2) before returning.
+       * 
+       * @return False when the previous write failed, or this one when it was written directly.
+      */
+      bool submit(int fd, unsigned buffer, const char* data, std::size_t size) {
+        const bool written = wait();
+        pending_fd = fd;
+        pending_buffer = buffer;
+        pending_data = data;
+        pending_size = size;
+        if (push(false)) {
+          pending = true;
+          return written;
+        }
+        return writeAll(fd, data, size) && written;
+      }
+
+      /**
+       * @brief Waits for the write in flight, submitting the rest again when the kernel wrote only a part of it.
+       * 
+       * It returns only once the kernel is done with the buffer, so the buffer can be reused.
+       * 
+       * @return False when the write failed, also through write(2).
+      */
+      bool wait() {
+        if (!pending) return true;
+        std::chrono::microseconds backoff(0);
+        for (;;) {
+          const unsigned head = *cq_head;
+          if (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+            //The write is still in flight, when the kernel refuses to wait the completion queue is polled more and more slowly
+            if (::syscall(__NR_io_uring_enter, ring_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR) pause(backoff);
+            continue;
+          }
+          const int result = cqes[head & cq_mask].res;
+          __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+          if (result > 0) {
+            pending_data += result;
+            pending_size -= static_cast<std::size_t>(result);
+            if (pending_size == 0) break;
+            backoff = std::chrono::microseconds(0);
+          }
+          else if (result == -EAGAIN) pause(backoff);
+          else if (result != -EINTR) {
+            //An error, or nothing written at all: io_uring may refuse writes that write(2) still delivers (-ECANCELED,
+            //-EOPNOTSUPP on old kernels), so the rest goes through it and the write fails only if that fails too
+            pending = false;
+            return writeAll(pending_fd, pending_data, pending_size);
+          }
+          //Only a part was written or the write has to be tried again, the rest is submitted again
+          if (!push(true)) {
+            pending = false;
+            return writeAll(pending_fd, pending_data, pending_size);
+          }
+        }
+        pending = false;
+        return true;
+      }
+
+    private:
+      //Sleeps before polling or submitting again, twice as long every time up to a millisecond.
+      static void pause(std::chrono::microseconds& backoff) {
+        backoff = backoff.count() == 0 ? std::chrono::microseconds(1) : std::min(backoff * 2, std::chrono::microseconds(1000));
+        std::this_thread::sleep_for(backoff);
+      }
+
+      /**
+       * @brief Fills an entry for the pending write and hands it to the kernel, optionally waiting for it to complete.
+       * 
+       * @return False when the kernel didn't take the entry, it's then removed from the queue.
+      */
+      bool push(bool complete) {
+        const unsigned tail = *sq_tail;
+        const unsigned index = tail & sq_mask;
+        io_uring_sqe& entry = static_cast<io_uring_sqe*>(sqes)[index];
+        std::memset(&entry, 0, sizeof(entry));
+        entry.opcode = fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+        entry.fd = pending_fd;
+        entry.addr = reinterpret_cast<uint64_t>(pending_data);
+        entry.len = static_cast<uint32_t>(pending_size);
+        entry.off = static_cast<uint64_t>(-1); //At the current file position, like write(2)
+        if (fixed) entry.buf_index = static_cast<uint16_t>(pending_buffer);
+        sq_array[index] = index;
+        __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+        for (;;) {
+          //After an interruption the entry may be taken already, so only what the kernel hasn't taken is submitted
+          const unsigned head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+          if (head == tail + 1) return true;
+          const unsigned flags = complete ? IORING_ENTER_GETEVENTS : 0;
+          const long submitted = ::syscall(__NR_io_uring_enter, ring_fd, tail + 1 - head, complete ? 1 : 0, flags, nullptr, 0);
+          if (submitted > 0 || (submitted < 0 && errno == EINTR)) continue;
+          if (__atomic_load_n(sq_head, __ATOMIC_ACQUIRE) == tail + 1) return true;
+          //Without a polling thread the kernel reads the entries only inside io_uring_enter, so a refused entry can be taken back
+          __atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+          return false;
+        }
+      }
+
+      //Releases what open() set up, so the queue is unavailable.
+      bool close() {
+        if (sqes != MAP_FAILED) ::munmap(sqes, sqes_size);
+        if (cq_ring != sq_ring && cq_ring != MAP_FAILED) ::munmap(cq_ring, cq_size);
+        if (sq_ring != MAP_FAILED) ::munmap(sq_ring, sq_size);
+        sqes = cq_ring = sq_ring = MAP_FAILED;
+        ::close(ring_fd);
+        ring_fd = -1;
+        return false;
+      }
+
+      int ring_fd = -1;
+      void* sq_ring = MAP_FAILED;
+      void* cq_ring = MAP_FAILED;
+      void* sqes = MAP_FAILED;
+      std::size_t sq_size = 0;
+      std::size_t cq_size = 0;
+      std::size_t sqes_size = 0;
+      unsigned* sq_head = nullptr;
+      unsigned* sq_tail = nullptr;
+      unsigned* sq_array = nullptr;
+      unsigned sq_mask = 0;
+      unsigned* cq_head = nullptr;
+      unsigned* cq_tail = nullptr;
+      unsigned cq_mask = 0;
+      io_uring_cqe* cqes = nullptr;
+      bool fixed = false;
+      bool pending = false;
+      int pending_fd = -1;
+      unsigned pending_buffer = 0;
+      const char* pending_data = nullptr;
+      std::size_t pending_size = 0;
+    };
+    #endif
+
+    //Draws the cells of a progress bar with a color gradient, the filled part is drawn in eighths of a cell.
+    struct BarPainter {
+      std::size_t width = 40;
+      Rgb from{255, 95, 95};
+      Rgb to{95, 255, 135};
+      ColorDepth depth = ColorDepth::none;
+      std::vector<string> codes; //The escape code before every cell, empty when it doesn't change
+
+      //Encodes the color of every cell once, skipping the cells that have the same code as the previous one.
+      void prepare() {
+        codes.assign(width, string());
+        if (depth == ColorDepth::none) return;
+        string previous;
+        for (std::size_t cell = 0; cell < width; cell++) {
+          const auto mix = [&](uint8_t first, uint8_t last) {
+            return static_cast<uint8_t>(first + (static_cast<int>(last) - first) * static_cast<int>(cell) / static_cast<int>(width > 1 ? width - 1 : 1));
+          };
+          const auto code = makeStyle(fg(mix(from.red, to.red), mix(from.green, to.green), mix(from.blue, to.blue)), depth);
+          if (code.view() != previous) codes[cell] = previous = string(code.view());
+        }
+      }
+
+      /**
+       * @brief Appends the bar, the percentage and the counts for a progress value.
+       * 
+       * @param out The string to append to.
+       * @param progress The progress, capped to the total.
+       * @param total The value that fills the bar.
+      */
+      void append(string& out, uint64_t progress, uint64_t total) {
+        static constexpr std::string_view eighths[8] = {"", "\u258F", "\u258E", "\u258D", "\u258C", "\u258B", "\u258A", "\u2589"};
+        if (codes.size() != width) prepare();
+        if (progress > total) progress = total;
+        const double fraction = total == 0 ? 1.0 : static_cast<double>(progress) / static_cast<double>(total);
+        const std::size_t units = static_cast<std::size_t>(fraction * static_cast<double>(width * 8));
+        const std::size_t full = units / 8;
+
+        const std::size_t drawn = full + (units % 8 != 0 ? 1 : 0); //Only the drawn cells are colored
+        for (std::size_t cell = 0; cell < drawn; cell++) {
+          out.append(codes[cell]);
+          out.append(cell < full ? std::string_view("\u2588") : eighths[units % 8]);
+        }
+        if (drawn != 0 && depth != ColorDepth::none) out.append(RESET_STYLE);
+        out.append(width - drawn, ' ');
+        const string percent = to_string(static_cast<unsigned>(fraction * 100));
+        out.append(4 - percent.size(), ' ');
+        out.append(percent);
+        out.append("% ");
+        out.append(to_string(progress));
+        out.push_back('/');
+        out.append(to_string(total));
+      }
+    };
+
+    //Thread that calls a function at a fixed interval until it's stopped, waking up at once when stopped.
+    class FrameThread {
+    public:
+      ~FrameThread() {
+        stop();
+      }
+
+      template <typename Function>
+      void start(std::chrono::microseconds interval, Function&& function) {
+        if (worker.joinable()) return;
+        stopping = false;
+        worker = std::thread([this, interval, function = std::forward<Function>(function)]() mutable {
+          std::unique_lock<std::mutex> lock(mutex);
+          while (!stopping) {
+            function();
+            wake.wait_for(lock, interval, [this] { return stopping; });
+          }
+        });
+      }
+
+      //Waits for the thread to end, does nothing if it isn't running.
+      void stop() {
+        if (!worker.joinable()) return;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          stopping = true;
+        }
+        wake.notify_one();
+        worker.join();
+      }
+
+    private:
+      std::thread worker;
+      std::mutex mutex;
+      std::condition_variable wake;
+      bool stopping = false;
+    };
+
+    static_assert((CLISTYLE_SEQUENCE_CACHE_SIZE & (CLISTYLE_SEQUENCE_CACHE_SIZE - 1)) == 0, "CLISTYLE_SEQUENCE_CACHE_SIZE must be a power of 2");
+
+    /**
+     * @brief Direct-mapped cache of the escape codes built at runtime, one per thread.
+     * 
+     * Every style and color depth maps to a single slot, a different style that maps to the same slot replaces it.
+    */
+    class SequenceCache {
+    public:
+      /**
+       * @brief Returns the escape code of a style, building it only when it isn't in the cache.
+       * 
+       * @param style The style to encode.
+       * @param depth The color depth of the output.
+       * 
+       * @return The escape code, valid until the next lookup from the same thread.
+      */
+      std::string_view lookup(const Style& style, ColorDepth depth) {
+        Entry& entry = entries[slot(style, depth)];
+        if (entry.used && entry.depth == depth && entry.style == style) {
+          hits++;
+          return entry.sequence.view();
+        }
+        misses++;
+        entry.used = true;
+        entry.style = style;
+        entry.depth = depth;
+        entry.sequence = makeStyle(style, depth);
+        return entry.sequence.view();
+      }
+
+      uint64_t hits = 0;
+      uint64_t misses = 0;
+
+    private:
+      struct Entry {
+        Style style;
+        ColorDepth depth = ColorDepth::none;
+        bool used = false;
+        FixedString<STYLE_SEQUENCE_SIZE> sequence;
+      };
+
+      //Hashes the fields of the style and the depth with FNV-1a, field by field so the padding is never read.
+      static std::size_t slot(const Style& style, ColorDepth depth) {
+        const uint8_t bytes[] = {
+          static_cast<uint8_t>(style.attributes), static_cast<uint8_t>(style.attributes >> 8), style.kinds, style.underline_kind,
+          style.foreground[0], style.foreground[1], style.foreground[2], style.background[0], style.background[1], style.background[2],
+          style.underline[0], style.underline[1], style.underline[2]
+        };
+        uint64_t hash = 0xCBF29CE484222325ull ^ static_cast<uint64_t>(depth);
+        for (const uint8_t byte : bytes) hash = (hash ^ byte) * 0x100000001B3ull;
+        return static_cast<std::size_t>(hash ^ (hash >> 32)) & (CLISTYLE_SEQUENCE_CACHE_SIZE - 1);
+      }
+
+      Entry entries[CLISTYLE_SEQUENCE_CACHE_SIZE];
+    };
+
+    //Returns the cache of the calling thread.
+    inline SequenceCache& sequenceCache() {
+      thread_local SequenceCache cache;
+      return cache;
+    }
+
+    //Returns the escape code of a style from the cache of the calling thread.
+    inline std::string_view cachedStyle(const Style& style, ColorDepth depth) {
+      return sequenceCache().lookup(style, depth);
+    }
+  }
+
+  constexpr uint8_t TEXT = 1;
+  constexpr uint8_t BACKGROUND = 0;
+
+  /**
+   * @brief Probes the terminal again for the ANSI escape codes.
+   * 
+   * It enables the VT sequences on Windows and detects what the standard output and the standard error
+   * can show. This already happens during static initialization, call it to color the output from the static
+   * initializers of other files, that may run first, or after the environment or the outputs changed.
+   * It's safe to call while other threads color their output, they see either the old or the new result.
+   * 
+   * @return True if the user terminal can handle the ANSI escape codes.
+  */
+  inline bool init() {
+    _private::probeTerminal();
+    return _private::outputDepth() != ColorDepth::none;
+  }
+
+  /**
+   * @brief Returns how many colors the output behind a stream can show, as detected at startup.
+   * 
+   * std::cerr and std::clog use the standard error, every other stream uses the standard output.
+   * 
+   * @param os The stream to check.
+   * 
+   * @return The color depth of the output.
+  */
+  inline ColorDepth color_depth(const ostream& os) {
+    return _private::streamColorDepth(os);
+  }
+
+  //Functions for color downsampling
+
+  /**
+   * @brief Converts an RGB color to the closest color of the xterm 256 color palette.
+   * 
+   * @param red Red component of the color (0-255).
+   * @param green Green component of the color (0-255).
+   * @param blue Blue component of the color (0-255).
+   * 
+   * @return The index of the palette color.
+  */
+  constexpr uint8_t to_palette(uint8_t red, uint8_t green, uint8_t blue) {
+    return _private::rgbToPalette(red, green, blue);
+  }
+
+  /**
+   * @brief Converts an RGB color to the closest of the 16 standard and bright colors.
+   * 
+   * @param red Red component of the color (0-255).
+   * @param green Green component of the color (0-255).
+   * @param blue Blue component of the color (0-255).
+   * 
+   * @return The closest color.
+  */
+  constexpr Color to_basic(uint8_t red, uint8_t green, uint8_t blue) {
+    return _private::rgbToBasic(red, green, blue);
+  }
+
+  /**
+   * @brief Converts an array of RGB colors to the xterm 256 color palette, 8 colors at a time with SSE2 when available.
+   * 
+   * @param colors The colors to convert.
+   * @param indexes Where to write the palette indexes, one for every color.
+   * @param count The number of colors.
+  */
+  inline void to_palette(const Rgb* colors, uint8_t* indexes, std::size_t count) {
+    std::size_t index = 0;
+    #ifdef CLISTYLE_SSE2
+    for (; index + 8 <= count; index += 8) {
+      const Rgb* batch = colors + index;
+      const __m128i red = _mm_setr_epi16(batch[0].red, batch[1].red, batch[2].red, batch[3].red, batch[4].red, batch[5].red, batch[6].red, batch[7].red);
+      const __m128i green = _mm_setr_epi16(batch[0].green, batch[1].green, batch[2].green, batch[3].green, batch[4].green, batch[5].green, batch[6].green, batch[7].green);
+      const __m128i blue = _mm_setr_epi16(batch[0].blue, batch[1].blue, batch[2].blue, batch[3].blue, batch[4].blue, batch[5].blue, batch[6].blue, batch[7].blue);
+      const __m128i palette = _private::rgbToPalette(red, green, blue);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(indexes + index), _mm_packus_epi16(palette, palette));
+    }
+    #endif
+    for (; index < count; index++) {
+      indexes[index] = _private::rgbToPalette(colors[index].red, colors[index].green, colors[index].blue);
+    }
+  }
+
+  /**
+   * @brief Converts an array of RGB colors to the closest of the 16 standard and bright colors.
+   * 
+   * @param colors The colors to convert.
+   * @param basic Where to write the converted colors, one for every color.
+   * @param count The number of colors.
+  */
+  inline void to_basic(const Rgb* colors, Color* basic, std::size_t count) {
+    uint8_t indexes[64];
+    for (std::size_t start = 0; start < count; start += 64) {
+      const std::size_t size = count - start < 64 ? count - start : 64;
+      to_palette(colors + start, indexes, size);
+      for (std::size_t index = 0; index < size; index++) basic[start + index] = _private::palette_to_basic[indexes[index]];
+    }
+  }
+
+  /**
+   * @brief Returns the stream with the a color, specified from the template params, for the background or text.
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @tparam red Red component of the color (0-255).
+   * @tparam green Green component of the color (0-255).
+   * @tparam blue Blue component of the color (0-255).
+   * 
+   * @param os The stream to apply the color to.
+   * 
+   * @return The modified stream.
+  */
+  template <uint8_t position, uint8_t red, uint8_t green, uint8_t blue>
+  ostream& color(ostream& os){
+    _private::checkPosition(position);
+    const Style change = position == TEXT ? fg(red, green, blue) : bg(red, green, blue);
+    return _private::applyToStream(os, change, _private::getColor<position, red, green, blue>(_private::streamDepth(os)));
+  }
+
+  /**
+   * @brief Applies the specified color, specified from the template params, to the text or background.
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @tparam red Red component of the color (0-255).
+   * @tparam green Green component of the color (0-255).
+   * @tparam blue Blue component of the color (0-255).
+   * 
+   * @param text The text to color.
+   * 
+   * @return The modified text with the applied color.
+  */
+  template <uint8_t position, uint8_t red, uint8_t green, uint8_t blue>
+  string color(const string& text) {
+    _private::checkPosition(position);
+    return position == TEXT ? _private::colorText<red, green, blue>(text) : _private::colorBackground<red, green, blue>(text);
+  }
+
+  /**
+   * @brief Applies the specified color, specified from the template params, to the text or background.
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @tparam red Red component of the color (0-255).
+   * @tparam green Green component of the color (0-255).
+   * @tparam blue Blue component of the color (0-255).
+   * 
+   * @param text The text to color. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with the applied color.
+  */
+  template <uint8_t position, uint8_t red, uint8_t green, uint8_t blue>
+  string color(string&& text) {
+    _private::checkPosition(position);
+    return position == TEXT ? _private::colorText<red, green, blue>(std::move(text)) : _private::colorBackground<red, green, blue>(std::move(text));
+  }
+  
+  /**
+   * @brief Applies the specified color, specified from the template params, to the text.
+   * 
+   * @tparam red Red component of the color (0-255).
+   * @tparam green Green component of the color (0-255).
+   * @tparam blue Blue component of the color (0-255).
+   * 
+   * @param text The text to color.
+   * 
+   * @return The modified text with the applied color.
+  */
+  template<uint8_t red, uint8_t green, uint8_t blue>
+  string color(const string& text) {
+    return _private::colorText<red, green, blue>(text);
+  }
+
+  /**
+   * @brief Applies the specified color, specified from the template params, to the text.
+   * 
+   * @tparam red Red component of the color (0-255).
+   * @tparam green Green component of the color (0-255).
+   * @tparam blue Blue component of the color (0-255).
+   * 
+   * @param text The text to color. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with the applied color.
+  */
+  template<uint8_t red, uint8_t green, uint8_t blue>
+  string color(string&& text) {
+    return _private::colorText<red, green, blue>(std::move(text));
+  }
+
+  /**
+   * @brief Applies to the stream the color specified from the template params.
+   * 
+   * @tparam red Red component of the color (0-255).
+   * @tparam green Green component of the color (0-255).
+   * @tparam blue Blue component of the color (0-255).
+   * 
+   * @param os The stream to apply the color to.
+   * 
+   * @return The modified stream.
+  */
+  template<uint8_t red, uint8_t green, uint8_t blue>
+  ostream& color(ostream& os) {
+    return _private::applyToStream(os, fg(red, green, blue), _private::colorText<red, green, blue>(_private::streamDepth(os)));
+  }
+
+  /**
+   * @brief Applies the specified color, specified from the template params, to the background.
+   * 
+   * @tparam red Red component of the color (0-255).
+   * @tparam green Green component of the color (0-255).
+   * @tparam blue Blue component of the color (0-255).
+   * 
+   * @param text The text to color.
+   * 
+   * @return The modified text with the applied background color.
+  */
+  template<uint8_t red, uint8_t green, uint8_t blue>
+  string on_color(const string& text) {
+    return _private::colorBackground<red, green, blue>(text);
+  }
+
+  /**
+   * @brief Applies the specified color, specified from the template params, to the background.
+   * 
+   * @tparam red Red component of the color (0-255).
+   * @tparam green Green component of the color (0-255).
+   * @tparam blue Blue component of the color (0-255).
+   * 
+   * @param text The text to color. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with the applied background color.
+  */
+  template<uint8_t red, uint8_t green, uint8_t blue>
+  string on_color(string&& text) {
+    return _private::colorBackground<red, green, blue>(std::move(text));
+  }
+
+  /**
+   * @brief Applies to the stream the color specified from the template params.
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @tparam red Red component of the color (0-255).
+   * @tparam green Green component of the color (0-255).
+   * @tparam blue Blue component of the color (0-255).
+   * 
+   * @param os The stream to apply the color to.
+   * 
+   * @return The modified stream.
+  */
+  template<uint8_t red, uint8_t green, uint8_t blue>
+  ostream& on_color(ostream& os) {
+    return _private::applyToStream(os, bg(red, green, blue), _private::colorBackground<red, green, blue>(_private::streamDepth(os)));
+  }
+
+  //Functions for runtime colors
+
+  //Room needed by the buffer given to color(), enough for the longest escape code: "\033[38;2;255;255;255m"
+  constexpr std::size_t COLOR_SEQUENCE_SIZE = _private::RGB_SEQUENCE_SIZE;
+
+  /**
+   * @brief Writes into a buffer the escape code of a color known only at runtime, without allocating.
+   * 
+   * @param buffer The buffer to write to, with room for COLOR_SEQUENCE_SIZE characters. No null terminator is added.
+   * @param position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @param red Red component of the color (0-255).
+   * @param green Green component of the color (0-255).
+   * @param blue Blue component of the color (0-255).
+   * @param depth The color depth of the output, the standard output's by default. Nothing is written with ColorDepth::none.
+   * 
+   * @return The number of characters written.
+  */
+  inline std::size_t color(char* buffer, uint8_t position, uint8_t red, uint8_t green, uint8_t blue, ColorDepth depth = _private::outputDepth()) {
+    _private::checkPosition(position);
+    if (depth == ColorDepth::none) return 0;
+    const std::string_view code = _private::cachedStyle(position == TEXT ? fg(red, green, blue) : bg(red, green, blue), depth);
+    std::memcpy(buffer, code.data(), code.size());
+    return code.size();
+  }
+
+  //A color known only at runtime, applied when it's inserted in a stream.
+  struct RuntimeColor {
+    Style change;
+  };
+
+  /**
+   * @brief Creates a color known only at runtime, to insert in a stream.
+   * 
+   * Example: cout << CLIStyle::color(CLIStyle::TEXT, heat, 0, 255 - heat) << "#";
+   * 
+   * @param position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @param red Red component of the color (0-255).
+   * @param green Green component of the color (0-255).
+   * @param blue Blue component of the color (0-255).
+   * 
+   * @return The color, that writes its escape code when it's inserted in a stream.
+  */
+  inline RuntimeColor color(uint8_t position, uint8_t red, uint8_t green, uint8_t blue) {
+    _private::checkPosition(position);
+    return RuntimeColor{position == TEXT ? fg(red, green, blue) : bg(red, green, blue)};
+  }
+
+  /**
+   * @brief Applies to the stream a color known only at runtime, without allocating.
+   * 
+   * @param os The stream to apply the color to.
+   * @param color The color returned by color() or color256().
+   * 
+   * @return The modified stream.
+  */
+  inline ostream& operator<<(ostream& os, const RuntimeColor& color) {
+    return _private::applyToStream(os, color.change, _private::cachedStyle(color.change, _private::streamDepth(os)));
+  }
+
+  //Functions for palette colors
+
+  /**
+   * @brief Applies to the stream a color of the xterm 256 color palette, for the background or text.
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @tparam index The index of the color in the palette (0-255).
+   * 
+   * @param os The stream to apply the color to.
+   * 
+   * @return The modified stream.
+  */
+  template <uint8_t position, uint8_t index>
+  ostream& color256(ostream& os) {
+    _private::checkPosition(position);
+    const Style change = position == TEXT ? fg256(index) : bg256(index);
+    return _private::applyToStream(os, change, _private::getPaletteColor<position, index>(_private::streamDepth(os)));
+  }
+
+  /**
+   * @brief Applies a color of the xterm 256 color palette to the text or background.
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @tparam index The index of the color in the palette (0-255).
+   * 
+   * @param text The text to color.
+   * 
+   * @return The modified text with the applied color.
+  */
+  template <uint8_t position, uint8_t index>
+  string color256(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled(_private::getPaletteColor<position, index>(_private::outputDepth()), text);
+  }
+
+  /**
+   * @brief Applies a color of the xterm 256 color palette to the text or background.
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @tparam index The index of the color in the palette (0-255).
+   * 
+   * @param text The text to color. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with the applied color.
+  */
+  template <uint8_t position, uint8_t index>
+  string color256(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled(_private::getPaletteColor<position, index>(_private::outputDepth()), std::move(text));
+  }
+
+  /**
+   * @brief Writes into a buffer the escape code of a palette color known only at runtime, without allocating.
+   * 
+   * @param buffer The buffer to write to, with room for COLOR_SEQUENCE_SIZE characters. No null terminator is added.
+   * @param position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @param index The index of the color in the palette (0-255).
+   * @param depth The color depth of the output, the standard output's by default. Nothing is written with ColorDepth::none.
+   * 
+   * @return The number of characters written.
+  */
+  inline std::size_t color256(char* buffer, uint8_t position, uint8_t index, ColorDepth depth = _private::outputDepth()) {
+    _private::checkPosition(position);
+    if (depth == ColorDepth::none) return 0;
+    const std::string_view code = _private::cachedStyle(position == TEXT ? fg256(index) : bg256(index), depth);
+    std::memcpy(buffer, code.data(), code.size());
+    return code.size();
+  }
+
+  /**
+   * @brief Creates a palette color known only at runtime, to insert in a stream.
+   * 
+   * Example: cout << CLIStyle::color256(CLIStyle::TEXT, 196) << "hot";
+   * 
+   * @param position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * @param index The index of the color in the palette (0-255).
+   * 
+   * @return The color, that writes its escape code when it's inserted in a stream.
+  */
+  inline RuntimeColor color256(uint8_t position, uint8_t index) {
+    _private::checkPosition(position);
+    return RuntimeColor{position == TEXT ? fg256(index) : bg256(index)};
+  }
+
+  //Lookups in the cache of runtime escape codes of the calling thread.
+  struct SequenceCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+  };
+
+  /**
+   * @brief Returns how many runtime colors and styles of the calling thread were found in its cache of escape codes.
+   * 
+   * Many misses on a small set of colors mean that CLISTYLE_SEQUENCE_CACHE_SIZE should be raised.
+  */
+  inline SequenceCacheStats sequence_cache_stats() {
+    const _private::SequenceCache& cache = _private::sequenceCache();
+    return SequenceCacheStats{cache.hits, cache.misses};
+  }
+
+  // Functions for grey color
+
+  /**
+   * @brief Applies the color grey either for the background or for the text, based on the position
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * 
+   * @param os The stream to apply the color to.
+   * 
+   * @return The modified stream.
+  */
+  template<uint8_t position>
+  ostream& grey(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::grey);
+  }
+
+  /**
+   * @brief Applies the color grey either for the background or for the text, based on the position
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * 
+   * @param text The text to color.
+   * 
+   * @return The modified text with the grey color.
+  */
+
+  template<uint8_t position>
+  string grey(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT) ? _private::color_text[Color::grey] : _private::color_background[Color::grey], text);
+  }
+
+  /**
+   * @brief Applies the color grey either for the background or for the text, based on the position
+   * 
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color applies.
+   * 
+   * @param text The text to color. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with the grey color.
+  */
+  template<uint8_t position>
+  string grey(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT) ? _private::color_text[Color::grey] : _private::color_background[Color::grey], std::move(text));
+  }
+
+  /**
+   * @brief Applies the color grey to the text
+   * 
+   * @param text The text to color.
+   * 
+   * @return The modified text with the grey color.
+  */
+  inline string grey(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::grey], text);
+  }
+
+  /**
+   * @brief Applies the color grey to the text
+   * 
+   * @param text The text to color. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with the grey color.
+  */
+  inline string grey(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::grey], std::move(text));
+  }
+
+  /**
+   * @brief Applies the color grey to the text
+   * 
+   * @param os The stream to apply the color to.
+   * 
+   * @return The modified stream.
+  */
+  inline ostream& grey(ostream& os){
+    return _private::applyColor(os, TEXT, Color::grey);
+  }
+
+  /**
+   * @brief Applies the color grey to the background
+   * 
+   * @param text The text to color.
+   * 
+   * @return The modified text with the grey color.
+  */
+  inline string on_grey(const string& text){
+    return _private::buildStyled(_private::color_background[Color::grey], text);
+  }
+
+  /**
+   * @brief Applies the color grey to the background
+   * 
+   * @param text The text to color. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with the grey color.
+  */
+  inline string on_grey(string&& text){
+    return _private::buildStyled(_private::color_background[Color::grey], std::move(text));
+  }
+
+  /**
+   * @brief Applies the color grey to the background
+   * 
+   * @param os The stream to apply the color to.
+   * 
+   * @return The modified stream.
+  */
+  inline ostream& on_grey(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::grey);
+  }
+
+  // Functions for bright grey color
+  /**
+   * @brief Applies a bright grey color to the text or background based on the position.
+   *
+   * This function applies the bright grey color to the specified position (either text or background).
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the bright grey color applied.
+  */
+  template<uint8_t position>
+  ostream& bright_grey(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::bright_grey);
+  }
+
+  /**
+   * @brief Applies a bright grey color to the text based on the position.
+   *
+   * This function applies the bright grey color to the specified position (either text or background).
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright grey color will be applied.
+   * @return The modified text with the bright grey color applied.
+  */
+  template<uint8_t position>
+  string bright_grey(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_grey] : _private::color_background[Color::bright_grey], text);
+  }
+
+  /**
+   * @brief Applies a bright grey color to the text based on the position.
+   *
+   * This function applies the bright grey color to the specified position (either text or background).
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright grey color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright grey color applied.
+  */
+  template<uint8_t position>
+  string bright_grey(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_grey] : _private::color_background[Color::bright_grey], std::move(text));
+  }
+
+  /**
+   * @brief Applies a bright grey color to the text.
+   *
+   * This function applies the bright grey color to the text.
+   *
+   * @param text The text to which the bright grey color will be applied.
+   * @return The modified text with the bright grey color applied.
+  */
+  inline string bright_grey(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_grey], text);
+  }
+
+  /**
+   * @brief Applies a bright grey color to the text.
+   *
+   * This function applies the bright grey color to the text.
+   *
+   * @param text The text to which the bright grey color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright grey color applied.
+  */
+  inline string bright_grey(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_grey], std::move(text));
+  }
+
+  /**
+   * @brief Applies a bright grey color to the text.
+   *
+   * This function applies the bright grey color to the text.
+   *
+   * @param os The output stream to which the bright grey color will be applied.
+   * @return The modified output stream with the bright grey color applied.
+  */
+  inline ostream& bright_grey(ostream& os){
+    return _private::applyColor(os, TEXT, Color::bright_grey);
+  }
+
+  /**
+   * @brief Applies a bright grey color to the background.
+   *
+   * This function applies the bright grey color to the background.
+   *
+   * @param text The text to which the bright grey color will be applied.
+   * @return The modified text with the bright grey color applied.
+  */
+  inline string on_bright_grey(const string& text){
+    return _private::buildStyled(_private::color_background[Color::bright_grey], text);
+  }
+
+  /**
+   * @brief Applies a bright grey color to the background.
+   *
+   * This function applies the bright grey color to the background.
+   *
+   * @param text The text to which the bright grey color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright grey color applied.
+  */
+  inline string on_bright_grey(string&& text){
+    return _private::buildStyled(_private::color_background[Color::bright_grey], std::move(text));
+  }
+
+  /**
+   * @brief Applies a bright grey color to the background.
+   *
+   * This function applies the bright grey color to the background.
+   *
+   * @param os The output stream to which the bright grey color will be applied.
+   * @return The modified output stream with the bright grey color applied.
+  */
+  inline ostream& on_bright_grey(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::bright_grey);
+  }
+
+  // Functions for red color
+
+  /**
+   * @brief Applies the red color to the text or background based on the position.
+   *
+   * This function applies the red color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the red color applied.
+  */
+  template<uint8_t position>
+  ostream& red(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::red);
+  }
+
+  /**
+   * @brief Applies the red color to the text based on the position.
+   *
+   * This function applies the red color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the red color will be applied.
+   * @return The modified text with the red color applied.
+  */
+  template<uint8_t position>
+  string red(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::red] : _private::color_background[Color::red], text);
+  }
+
+  /**
+   * @brief Applies the red color to the text based on the position.
+   *
+   * This function applies the red color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the red color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the red color applied.
+  */
+  template<uint8_t position>
+  string red(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::red] : _private::color_background[Color::red], std::move(text));
+  }
+
+  /**
+   * @brief Applies the red color to the text.
+   *
+   * This function applies the red color to the text.
+   *
+   * @param text The text to which the red color will be applied.
+   * @return The modified text with the red color applied.
+  */
+  inline string red(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::red], text);
+  }
+
+  /**
+   * @brief Applies the red color to the text.
+   *
+   * This function applies the red color to the text.
+   *
+   * @param text The text to which the red color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the red color applied.
+  */
+  inline string red(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::red], std::move(text));
+  }
+
+  /**
+   * @brief Applies the red color to the text.
+   *
+   * This function applies the red color to the text.
+   *
+   * @param os The output stream to which the red color will be applied.
+   * @return The modified output stream with the red color applied.
+  */
+  inline ostream& red(ostream& os){
+    return _private::applyColor(os, TEXT, Color::red);
+  }
+
+  /**
+   * @brief Applies the red color to the background.
+   *
+   * This function applies the red color to the background.
+   *
+   * @param text The text to which the red color will be applied.
+   * @return The modified text with the red color applied.
+  */
+  inline string on_red(const string& text){
+    return _private::buildStyled(_private::color_background[Color::red], text);
+  }
+
+  /**
+   * @brief Applies the red color to the background.
+   *
+   * This function applies the red color to the background.
+   *
+   * @param text The text to which the red color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the red color applied.
+  */
+  inline string on_red(string&& text){
+    return _private::buildStyled(_private::color_background[Color::red], std::move(text));
+  }
+
+  /**
+   * @brief Applies the red color to the background.
+   *
+   * This function applies the red color to the background.
+   *
+   * @param os The output stream to which the red color will be applied.
+   * @return The modified output stream with the red color applied.
+  */
+  inline ostream& on_red(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::red);
+  }
+
+  // Functions for bright red color
+
+  /**
+   * @brief Applies the bright red color to the text or background based on the position.
+   *
+   * This function applies the bright red color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the bright red color applied.
+  */
+  template<uint8_t position>
+  ostream& bright_red(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::bright_red);
+  }
+
+  /**
+   * @brief Applies the bright red color to the text based on the position.
+   *
+   * This function applies the bright red color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright red color will be applied.
+   * @return The modified text with the bright red color applied.
+  */
+  template<uint8_t position>
+  string bright_red(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_red] : _private::color_background[Color::bright_red], text);
+  }
+
+  /**
+   * @brief Applies the bright red color to the text based on the position.
+   *
+   * This function applies the bright red color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright red color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright red color applied.
+  */
+  template<uint8_t position>
+  string bright_red(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_red] : _private::color_background[Color::bright_red], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright red color to the text.
+   *
+   * This function applies the bright red color to the text.
+   *
+   * @param text The text to which the bright red color will be applied.
+   * @return The modified text with the bright red color applied.
+  */
+  inline string bright_red(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_red], text);
+  }
+
+  /**
+   * @brief Applies the bright red color to the text.
+   *
+   * This function applies the bright red color to the text.
+   *
+   * @param text The text to which the bright red color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright red color applied.
+  */
+  inline string bright_red(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_red], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright red color to the text.
+   *
+   * This function applies the bright red color to the text.
+   *
+   * @param os The output stream to which the bright red color will be applied.
+   * @return The modified output stream with the bright red color applied.
+  */
+  inline ostream& bright_red(ostream& os){
+    return _private::applyColor(os, TEXT, Color::bright_red);
+  }
+
+  /**
+   * @brief Applies the bright red color to the background.
+   *
+   * This function applies the bright red color to the background.
+   *
+   * @param text The text to which the bright red color will be applied.
+   * @return The modified text with the bright red color applied.
+  */
+  inline string on_bright_red(const string& text){
+    return _private::buildStyled(_private::color_background[Color::bright_red], text);
+  }
+
+  /**
+   * @brief Applies the bright red color to the background.
+   *
+   * This function applies the bright red color to the background.
+   *
+   * @param text The text to which the bright red color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright red color applied.
+  */
+  inline string on_bright_red(string&& text){
+    return _private::buildStyled(_private::color_background[Color::bright_red], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright red color to the background.
+   *
+   * This function applies the bright red color to the background.
+   *
+   * @param os The output stream to which the bright red color will be applied.
+   * @return The modified output stream with the bright red color applied.
+  */
+  inline ostream& on_bright_red(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::bright_red);
+  }
+
+  //Functions for the color green
+
+  /**
+   * @brief Applies the green color to the text or background based on the position.
+   *
+   * This function applies the green color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the green color applied.
+  */
+  template<uint8_t position>
+  ostream& green(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::green);
+  }
+
+  /**
+   * @brief Applies the green color to the text based on the position.
+   *
+   * This function applies the green color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the green color will be applied.
+   * @return The modified text with the green color applied.
+  */
+  template<uint8_t position>
+  string green(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::green] : _private::color_background[Color::green], text);
+  }
+
+  /**
+   * @brief Applies the green color to the text based on the position.
+   *
+   * This function applies the green color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the green color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the green color applied.
+  */
+  template<uint8_t position>
+  string green(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::green] : _private::color_background[Color::green], std::move(text));
+  }
+
+  /**
+   * @brief Applies the green color to the text.
+   *
+   * This function applies the green color to the text.
+   *
+   * @param text The text to which the green color will be applied.
+   * @return The modified text with the green color applied.
+  */
+  inline string green(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::green], text);
+  }
+
+  /**
+   * @brief Applies the green color to the text.
+   *
+   * This function applies the green color to the text.
+   *
+   * @param text The text to which the green color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the green color applied.
+  */
+  inline string green(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::green], std::move(text));
+  }
+
+  /**
+   * @brief Applies the green color to the text.
+   *
+   * This function applies the green color to the text.
+   *
+   * @param os The output stream to which the green color will be applied.
+   * @return The modified output stream with the green color applied.
+  */
+  inline ostream& green(ostream& os){
+    return _private::applyColor(os, TEXT, Color::green);
+  }
+
+  /**
+   * @brief Applies the green color to the background.
+   *
+   * This function applies the green color to the background.
+   *
+   * @param text The text to which the green color will be applied.
+   * @return The modified text with the green color applied.
+  */
+  inline string on_green(const string& text){
+    return _private::buildStyled(_private::color_background[Color::green], text);
+  }
+
+  /**
+   * @brief Applies the green color to the background.
+   *
+   * This function applies the green color to the background.
+   *
+   * @param text The text to which the green color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the green color applied.
+  */
+  inline string on_green(string&& text){
+    return _private::buildStyled(_private::color_background[Color::green], std::move(text));
+  }
+
+  /**
+   * @brief Applies the green color to the background.
+   *
+   * This function applies the green color to the background.
+   *
+   * @param os The output stream to which the green color will be applied.
+   * @return The modified output stream with the green color applied.
+  */
+  inline ostream& on_green(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::green);
+  }
+
+  // Functions for bright green color
+  /**
+   * @brief Applies the bright green color to the text or background based on the position.
+   *
+   * This function applies the bright green color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the bright green color applied.
+  */
+  template<uint8_t position>
+  ostream& bright_green(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::bright_green);
+  }
+
+  /**
+   * @brief Applies the bright green color to the text based on the position.
+   *
+   * This function applies the bright green color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright green color will be applied.
+   * @return The modified text with the bright green color applied.
+  */
+  template<uint8_t position>
+  string bright_green(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_green] : _private::color_background[Color::bright_green], text);
+  }
+
+  /**
+   * @brief Applies the bright green color to the text based on the position.
+   *
+   * This function applies the bright green color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright green color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright green color applied.
+  */
+  template<uint8_t position>
+  string bright_green(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_green] : _private::color_background[Color::bright_green], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright green color to the text.
+   *
+   * This function applies the bright green color to the text.
+   *
+   * @param text The text to which the bright green color will be applied.
+   * @return The modified text with the bright green color applied.
+  */
+  inline string bright_green(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_green], text);
+  }
+
+  /**
+   * @brief Applies the bright green color to the text.
+   *
+   * This function applies the bright green color to the text.
+   *
+   * @param text The text to which the bright green color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright green color applied.
+  */
+  inline string bright_green(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_green], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright green color to the text.
+   *
+   * This function applies the bright green color to the text.
+   *
+   * @param os The output stream to which the bright green color will be applied.
+   * @return The modified output stream with the bright green color applied.
+  */
+  inline ostream& bright_green(ostream& os){
+    return _private::applyColor(os, TEXT, Color::bright_green);
+  }
+
+  /**
+   * @brief Applies the bright green color to the background.
+   *
+   * This function applies the bright green color to the background.
+   *
+   * @param text The text to which the bright green color will be applied.
+   * @return The modified text with the bright green color applied.
+  */
+  inline string on_bright_green(const string& text){
+    return _private::buildStyled(_private::color_background[Color::bright_green], text);
+  }
+
+  /**
+   * @brief Applies the bright green color to the background.
+   *
+   * This function applies the bright green color to the background.
+   *
+   * @param text The text to which the bright green color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright green color applied.
+  */
+  inline string on_bright_green(string&& text){
+    return _private::buildStyled(_private::color_background[Color::bright_green], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright green color to the background.
+   *
+   * This function applies the bright green color to the background.
+   *
+   * @param os The output stream to which the bright green color will be applied.
+   * @return The modified output stream with the bright green color applied.
+  */
+  inline ostream& on_bright_green(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::bright_green);
+  }
+
+  // Functions for yellow color
+  /**
+   * @brief Applies the yellow color to the text or background based on the position.
+   *
+   * This function applies the yellow color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the yellow color applied.
+  */
+  template<uint8_t position>
+  ostream& yellow(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::yellow);
+  }
+
+  /**
+   * @brief Applies the yellow color to the text based on the position.
+   *
+   * This function applies the yellow color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the yellow color will be applied.
+   * @return The modified text with the yellow color applied.
+   */
+  template<uint8_t position>
+  string yellow(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::yellow] : _private::color_background[Color::yellow], text);
+  }
+
+  /**
+   * @brief Applies the yellow color to the text based on the position.
+   *
+   * This function applies the yellow color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the yellow color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the yellow color applied.
+   */
+  template<uint8_t position>
+  string yellow(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::yellow] : _private::color_background[Color::yellow], std::move(text));
+  }
+
+  /**
+   * @brief Applies the yellow color to the text.
+   *
+   * This function applies the yellow color to the text.
+   *
+   * @param text The text to which the yellow color will be applied.
+   * @return The modified text with the yellow color applied.
+   */
+  inline string yellow(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::yellow], text);
+  }
+
+  /**
+   * @brief Applies the yellow color to the text.
+   *
+   * This function applies the yellow color to the text.
+   *
+   * @param text The text to which the yellow color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the yellow color applied.
+   */
+  inline string yellow(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::yellow], std::move(text));
+  }
+
+  /**
+   * @brief Applies the yellow color to the text.
+   *
+   * This function applies the yellow color to the text.
+   *
+   * @param os The output stream to which the yellow color will be applied.
+   * @return The modified output stream with the yellow color applied.
+   */
+  inline ostream& yellow(ostream& os){
+    return _private::applyColor(os, TEXT, Color::yellow);
+  }
+
+  /**
+   * @brief Applies the yellow color to the background.
+   *
+   * This function applies the yellow color to the background.
+   *
+   * @param text The text to which the yellow color will be applied.
+   * @return The modified text with the yellow color applied.
+   */
+  inline string on_yellow(const string& text){
+    return _private::buildStyled(_private::color_background[Color::yellow], text);
+  }
+
+  /**
+   * @brief Applies the yellow color to the background.
+   *
+   * This function applies the yellow color to the background.
+   *
+   * @param text The text to which the yellow color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the yellow color applied.
+   */
+  inline string on_yellow(string&& text){
+    return _private::buildStyled(_private::color_background[Color::yellow], std::move(text));
+  }
+
+  /**
+   * @brief Applies the yellow color to the background.
+   *
+   * This function applies the yellow color to the background.
+   *
+   * @param os The output stream to which the yellow color will be applied.
+   * @return The modified output stream with the yellow color applied.
+   */
+  inline ostream& on_yellow(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::yellow);
+  }
+
+  // Functions for bright yellow color
+  /**
+   * @brief Applies the bright yellow color to the text or background based on the position.
+   *
+   * This function applies the bright yellow color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the bright yellow color applied.
+  */
+  template<uint8_t position>
+  ostream& bright_yellow(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::bright_yellow);
+  }
+
+  /**
+   * @brief Applies the bright yellow color to the text based on the position.
+   *
+   * This function applies the bright yellow color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright yellow color will be applied.
+   * @return The modified text with the bright yellow color applied.
+  */
+  template<uint8_t position>
+  string bright_yellow(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_yellow] : _private::color_background[Color::bright_yellow], text);
+  }
+
+  /**
+   * @brief Applies the bright yellow color to the text based on the position.
+   *
+   * This function applies the bright yellow color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright yellow color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright yellow color applied.
+  */
+  template<uint8_t position>
+  string bright_yellow(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_yellow] : _private::color_background[Color::bright_yellow], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright yellow color to the text.
+   *
+   * This function applies the bright yellow color to the text.
+   *
+   * @param text The text to which the bright yellow color will be applied.
+   * @return The modified text with the bright yellow color applied.
+  */
+  inline string bright_yellow(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_yellow], text);
+  }
+
+  /**
+   * @brief Applies the bright yellow color to the text.
+   *
+   * This function applies the bright yellow color to the text.
+   *
+   * @param text The text to which the bright yellow color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright yellow color applied.
+  */
+  inline string bright_yellow(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_yellow], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright yellow color to the text.
+   *
+   * This function applies the bright yellow color to the text.
+   *
+   * @param os The output stream to which the bright yellow color will be applied.
+   * @return The modified output stream with the bright yellow color applied.
+  */
+  inline ostream& bright_yellow(ostream& os){
+    return _private::applyColor(os, TEXT, Color::bright_yellow);
+  }
+
+  /**
+   * @brief Applies the bright yellow color to the background.
+   *
+   * This function applies the bright yellow color to the background.
+   *
+   * @param text The text to which the bright yellow color will be applied.
+   * @return The modified text with the bright yellow color applied.
+  */
+  inline string on_bright_yellow(const string& text){
+    return _private::buildStyled(_private::color_background[Color::bright_yellow], text);
+  }
+
+  /**
+   * @brief Applies the bright yellow color to the background.
+   *
+   * This function applies the bright yellow color to the background.
+   *
+   * @param text The text to which the bright yellow color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright yellow color applied.
+  */
+  inline string on_bright_yellow(string&& text){
+    return _private::buildStyled(_private::color_background[Color::bright_yellow], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright yellow color to the background.
+   *
+   * This function applies the bright yellow color to the background.
+   *
+   * @param os The output stream to which the bright yellow color will be applied.
+   * @return The modified output stream with the bright yellow color applied.
+  */
+  inline ostream& on_bright_yellow(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::bright_yellow);
+  }
+
+  // Functions for blue color
+  /**
+   * @brief Applies the blue color to the text or background based on the position.
+   *
+   * This function applies the blue color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the blue color applied.
+  */
+  template<uint8_t position>
+  ostream& blue(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::blue);
+  }
+
+  /**
+   * @brief Applies the blue color to the text based on the position.
+   *
+   * This function applies the blue color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the blue color will be applied.
+   * @return The modified text with the blue color applied.
+  */
+  template<uint8_t position>
+  string blue(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::blue] : _private::color_background[Color::blue], text);
+  }
+
+  /**
+   * @brief Applies the blue color to the text based on the position.
+   *
+   * This function applies the blue color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the blue color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the blue color applied.
+  */
+  template<uint8_t position>
+  string blue(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::blue] : _private::color_background[Color::blue], std::move(text));
+  }
+
+  /**
+   * @brief Applies the blue color to the text.
+   *
+   * This function applies the blue color to the text.
+   *
+   * @param text The text to which the blue color will be applied.
+   * @return The modified text with the blue color applied.
+  */
+  inline string blue(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::blue], text);
+  }
+
+  /**
+   * @brief Applies the blue color to the text.
+   *
+   * This function applies the blue color to the text.
+   *
+   * @param text The text to which the blue color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the blue color applied.
+  */
+  inline string blue(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::blue], std::move(text));
+  }
+
+  /**
+   * @brief Applies the blue color to the text.
+   *
+   * This function applies the blue color to the text.
+   *
+   * @param os The output stream to which the blue color will be applied.
+   * @return The modified output stream with the blue color applied.
+  */
+  inline ostream& blue(ostream& os){
+    return _private::applyColor(os, TEXT, Color::blue);
+  }
+
+  /**
+   * @brief Applies the blue color to the background.
+   *
+   * This function applies the blue color to the background.
+   *
+   * @param text The text to which the blue color will be applied.
+   * @return The modified text with the blue color applied.
+  */
+  inline string on_blue(const string& text){
+    return _private::buildStyled(_private::color_background[Color::blue], text);
+  }
+
+  /**
+   * @brief Applies the blue color to the background.
+   *
+   * This function applies the blue color to the background.
+   *
+   * @param text The text to which the blue color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the blue color applied.
+  */
+  inline string on_blue(string&& text){
+    return _private::buildStyled(_private::color_background[Color::blue], std::move(text));
+  }
+
+  /**
+   * @brief Applies the blue color to the background.
+   *
+   * This function applies the blue color to the background.
+   *
+   * @param os The output stream to which the blue color will be applied.
+   * @return The modified output stream with the blue color applied.
+  */
+  inline ostream& on_blue(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::blue);
+  }
+
+  // Functions for bright blue color
+  /**
+   * @brief Applies the bright blue color to the text or background based on the position.
+   *
+   * This function applies the bright blue color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the bright blue color applied.
+  */
+  template<uint8_t position>
+  ostream& bright_blue(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::bright_blue);
+  }
+
+  /**
+   * @brief Applies the bright blue color to the text based on the position.
+   *
+   * This function applies the bright blue color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright blue color will be applied.
+   * @return The modified text with the bright blue color applied.
+  */
+  template<uint8_t position>
+  string bright_blue(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_blue] : _private::color_background[Color::bright_blue], text);
+  }
+
+  /**
+   * @brief Applies the bright blue color to the text based on the position.
+   *
+   * This function applies the bright blue color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright blue color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright blue color applied.
+  */
+  template<uint8_t position>
+  string bright_blue(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_blue] : _private::color_background[Color::bright_blue], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright blue color to the text.
+   *
+   * This function applies the bright blue color to the text.
+   *
+   * @param text The text to which the bright blue color will be applied.
+   * @return The modified text with the bright blue color applied.
+  */
+  inline string bright_blue(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_blue], text);
+  }
+
+  /**
+   * @brief Applies the bright blue color to the text.
+   *
+   * This function applies the bright blue color to the text.
+   *
+   * @param text The text to which the bright blue color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright blue color applied.
+  */
+  inline string bright_blue(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_blue], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright blue color to the text.
+   *
+   * This function applies the bright blue color to the text.
+   *
+   * @param os The output stream to which the bright blue color will be applied.
+   * @return The modified output stream with the bright blue color applied.
+  */
+  inline ostream& bright_blue(ostream& os){
+    return _private::applyColor(os, TEXT, Color::bright_blue);
+  }
+
+  /**
+   * @brief Applies the bright blue color to the background.
+   *
+   * This function applies the bright blue color to the background.
+   *
+   * @param text The text to which the bright blue color will be applied.
+   * @return The modified text with the bright blue color applied.
+  */
+  inline string on_bright_blue(const string& text){
+    return _private::buildStyled(_private::color_background[Color::bright_blue], text);
+  }
+
+  /**
+   * @brief Applies the bright blue color to the background.
+   *
+   * This function applies the bright blue color to the background.
+   *
+   * @param text The text to which the bright blue color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright blue color applied.
+  */
+  inline string on_bright_blue(string&& text){
+    return _private::buildStyled(_private::color_background[Color::bright_blue], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright blue color to the background.
+   *
+   * This function applies the bright blue color to the background.
+   *
+   * @param os The output stream to which the bright blue color will be applied.
+   * @return The modified output stream with the bright blue color applied.
+  */
+  inline ostream& on_bright_blue(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::bright_blue);
+  }
+
+  // Functions for magenta color
+  /**
+   * @brief Applies the magenta color to the text or background based on the position.
+   *
+   * This function applies the magenta color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the magenta color applied.
   */
   template<uint8_t position>
-  string bright_grey(const string& text) {
+  ostream& magenta(ostream& os){
     _private::checkPosition(position);
-    const string bright_grey = (position == TEXT)? _private::color_text["bright grey"] : _private::color_background["bright grey"];
-    return bright_grey + text + _private::RESET_STYLE;
+    return _private::applyColor(os, position, Color::magenta);
   }
 
   /**
-   * @brief Applies a bright grey color to the text.
+   * @brief Applies the magenta color to the text based on the position.
    *
-   * This function applies the bright grey color to the text.
+   * This function applies the magenta color to the specified position (either text or background),
+   * depending on the value of the position parameter.
    *
-   * @param text The text to which the bright grey color will be applied.
-   * @return The modified text with the bright grey color applied.
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the magenta color will be applied.
+   * @return The modified text with the magenta color applied.
   */
-  inline string bright_grey(const string& text) {
-    const string bright_grey = _private::color_text["bright grey"];
-    return bright_grey + text + _private::RESET_STYLE;
+  template<uint8_t position>
+  string magenta(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::magenta] : _private::color_background[Color::magenta], text);
   }
 
   /**
-   * @brief Applies a bright grey color to the text.
+   * @brief Applies the magenta color to the text based on the position.
    *
-   * This function applies the bright grey color to the text.
+   * This function applies the magenta color to the specified position (either text or background),
+   * depending on the value of the position parameter.
    *
-   * @param os The output stream to which the bright grey color will be applied.
-   * @return The modified output stream with the bright grey color applied.
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the magenta color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the magenta color applied.
   */
-  inline ostream& bright_grey(ostream& os){
-    os << _private::color_text["bright grey"];
-    return os;
+  template<uint8_t position>
+  string magenta(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::magenta] : _private::color_background[Color::magenta], std::move(text));
   }
 
   /**
-   * @brief Applies a bright grey color to the background.
+   * @brief Applies the magenta color to the text.
    *
-   * This function applies the bright grey color to the background.
+   * This function applies the magenta color to the text.
    *
-   * @param text The text to which the bright grey color will be applied.
-   * @return The modified text with the bright grey color applied.
+   * @param text The text to which the magenta color will be applied.
+   * @return The modified text with the magenta color applied.
   */
-  inline string on_bright_grey(const string& text){
-    const string bright_grey = _private::color_background["bright grey"];
-    return bright_grey + text + _private::RESET_STYLE;
+  inline string magenta(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::magenta], text);
   }
 
   /**
-   * @brief Applies a bright grey color to the background.
+   * @brief Applies the magenta color to the text.
    *
-   * This function applies the bright grey color to the background.
+   * This function applies the magenta color to the text.
    *
-   * @param os The output stream to which the bright grey color will be applied.
-   * @return The modified output stream with the bright grey color applied.
+   * @param text The text to which the magenta color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the magenta color applied.
   */
-  inline ostream& on_bright_grey(ostream& os){
-    os << _private::color_background["bright grey"];
-    return os;
+  inline string magenta(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::magenta], std::move(text));
   }
 
-  // Functions for red color
+  /**
+   * @brief Applies the magenta color to the text.
+   *
+   * This function applies the magenta color to the text.
+   *
+   * @param os The output stream to which the magenta color will be applied.
+   * @return The modified output stream with the magenta color applied.
+  */
+  inline ostream& magenta(ostream& os){
+    return _private::applyColor(os, TEXT, Color::magenta);
+  }
 
   /**
-   * @brief Applies the red color to the text or background based on the position.
+   * @brief Applies the magenta color to the background.
    *
-   * This function applies the red color to the specified position (either text or background),
+   * This function applies the magenta color to the background.
+   *
+   * @param text The text to which the magenta color will be applied.
+   * @return The modified text with the magenta color applied.
+  */
+  inline string on_magenta(const string& text){
+    return _private::buildStyled(_private::color_background[Color::magenta], text);
+  }
+
+  /**
+   * @brief Applies the magenta color to the background.
+   *
+   * This function applies the magenta color to the background.
+   *
+   * @param text The text to which the magenta color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the magenta color applied.
+  */
+  inline string on_magenta(string&& text){
+    return _private::buildStyled(_private::color_background[Color::magenta], std::move(text));
+  }
+
+  /**
+   * @brief Applies the magenta color to the background.
+   *
+   * This function applies the magenta color to the background.
+   *
+   * @param os The output stream to which the magenta color will be applied.
+   * @return The modified output stream with the magenta color applied.
+  */
+  inline ostream& on_magenta(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::magenta);
+  }
+
+  // Functions for bright magenta color
+  /**
+   * @brief Applies the bright magenta color to the text or background based on the position.
+   *
+   * This function applies the bright magenta color to the specified position (either text or background),
    * depending on the value of the position parameter.
    *
    * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
    * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the red color applied.
+   * @return The modified output stream with the bright magenta color applied.
+  */
+  template<uint8_t position>
+  ostream& bright_magenta(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::bright_magenta);
+  }
+
+  /**
+   * @brief Applies the bright magenta color to the text based on the position.
+   *
+   * This function applies the bright magenta color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright magenta color will be applied.
+   * @return The modified text with the bright magenta color applied.
+  */
+  template<uint8_t position>
+  string bright_magenta(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_magenta] : _private::color_background[Color::bright_magenta], text);
+  }
+
+  /**
+   * @brief Applies the bright magenta color to the text based on the position.
+   *
+   * This function applies the bright magenta color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright magenta color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright magenta color applied.
+  */
+  template<uint8_t position>
+  string bright_magenta(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_magenta] : _private::color_background[Color::bright_magenta], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright magenta color to the text.
+   *
+   * This function applies the bright magenta color to the text.
+   *
+   * @param text The text to which the bright magenta color will be applied.
+   * @return The modified text with the bright magenta color applied.
+  */
+  inline string bright_magenta(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_magenta], text);
+  }
+
+  /**
+   * @brief Applies the bright magenta color to the text.
+   *
+   * This function applies the bright magenta color to the text.
+   *
+   * @param text The text to which the bright magenta color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright magenta color applied.
+  */
+  inline string bright_magenta(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_magenta], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright magenta color to the text.
+   *
+   * This function applies the bright magenta color to the text.
+   *
+   * @param os The output stream to which the bright magenta color will be applied.
+   * @return The modified output stream with the bright magenta color applied.
+  */
+  inline ostream& bright_magenta(ostream& os){
+    return _private::applyColor(os, TEXT, Color::bright_magenta);
+  }
+
+  /**
+   * @brief Applies the bright magenta color to the background.
+   *
+   * This function applies the bright magenta color to the background.
+   *
+   * @param text The text to which the bright magenta color will be applied.
+   * @return The modified text with the bright magenta color applied.
+  */
+  inline string on_bright_magenta(const string& text){
+    return _private::buildStyled(_private::color_background[Color::bright_magenta], text);
+  }
+
+  /**
+   * @brief Applies the bright magenta color to the background.
+   *
+   * This function applies the bright magenta color to the background.
+   *
+   * @param text The text to which the bright magenta color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright magenta color applied.
+  */
+  inline string on_bright_magenta(string&& text){
+    return _private::buildStyled(_private::color_background[Color::bright_magenta], std::move(text));
+  }
+
+  /**
+   * @brief Applies the bright magenta color to the background.
+   *
+   * This function applies the bright magenta color to the background.
+   *
+   * @param os The output stream to which the bright magenta color will be applied.
+   * @return The modified output stream with the bright magenta color applied.
+  */
+  inline ostream& on_bright_magenta(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::bright_magenta);
+  }
+
+  // Functions for cyan color
+  /**
+   * @brief Applies the cyan color to the text or background based on the position.
+   *
+   * This function applies the cyan color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the cyan color applied.
+  */
+  template<uint8_t position>
+  ostream& cyan(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::cyan);
+  }
+
+  /**
+   * @brief Applies the cyan color to the text based on the position.
+   *
+   * This function applies the cyan color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the cyan color will be applied.
+   * @return The modified text with the cyan color applied.
+  */
+  template<uint8_t position>
+  string cyan(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::cyan] : _private::color_background[Color::cyan], text);
+  }
+
+  /**
+   * @brief Applies the cyan color to the text based on the position.
+   *
+   * This function applies the cyan color to the specified position (either text or background),
+   * depending on the value of the position parameter.
+   *
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the cyan color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the cyan color applied.
+  */
+  template<uint8_t position>
+  string cyan(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::cyan] : _private::color_background[Color::cyan], std::move(text));
+  }
+
+  /**
+   * @brief Applies the cyan color to the text.
+   *
+   * This function applies the cyan color to the text.
+   *
+   * @param text The text to which the cyan color will be applied.
+   * @return The modified text with the cyan color applied.
   */
-  template<uint8_t position>
-  ostream& red(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["red"] : _private::color_background["red"]);
-    return os;
+  inline string cyan(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::cyan], text);
   }
 
   /**
-   * @brief Applies the red color to the text based on the position.
+   * @brief Applies the cyan color to the text.
    *
-   * This function applies the red color to the specified position (either text or background),
-   * depending on the value of the position parameter.
+   * This function applies the cyan color to the text.
    *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the red color will be applied.
-   * @return The modified text with the red color applied.
+   * @param text The text to which the cyan color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the cyan color applied.
   */
-  template<uint8_t position>
-  string red(const string& text) {
-    _private::checkPosition(position);
-    const string red = (position == TEXT)? _private::color_text["red"] : _private::color_background["red"];
-    return red + text + _private::RESET_STYLE;
+  inline string cyan(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::cyan], std::move(text));
   }
 
   /**
-   * @brief Applies the red color to the text.
+   * @brief Applies the cyan color to the text.
    *
-   * This function applies the red color to the text.
+   * This function applies the cyan color to the text.
    *
-   * @param text The text to which the red color will be applied.
-   * @return The modified text with the red color applied.
+   * @param os The output stream to which the cyan color will be applied.
+   * @return The modified output stream with the cyan color applied.
   */
-  inline string red(const string& text) {
-    const string red = _private::color_text["red"];
-    return red + text + _private::RESET_STYLE;
+  inline ostream& cyan(ostream& os){
+    return _private::applyColor(os, TEXT, Color::cyan);
   }
 
   /**
-   * @brief Applies the red color to the text.
+   * @brief Applies the cyan color to the background.
    *
-   * This function applies the red color to the text.
+   * This function applies the cyan color to the background.
    *
-   * @param os The output stream to which the red color will be applied.
-   * @return The modified output stream with the red color applied.
+   * @param text The text to which the cyan color will be applied.
+   * @return The modified text with the cyan color applied.
   */
-  inline ostream& red(ostream& os){
-    os << _private::color_text["red"];
-    return os;
+  inline string on_cyan(const string& text){
+    return _private::buildStyled(_private::color_background[Color::cyan], text);
   }
 
   /**
-   * @brief Applies the red color to the background.
+   * @brief Applies the cyan color to the background.
    *
-   * This function applies the red color to the background.
+   * This function applies the cyan color to the background.
    *
-   * @param text The text to which the red color will be applied.
-   * @return The modified text with the red color applied.
+   * @param text The text to which the cyan color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the cyan color applied.
   */
-  inline string on_red(const string& text){
-    const string red = _private::color_background["red"];
-    return red + text + _private::RESET_STYLE;
+  inline string on_cyan(string&& text){
+    return _private::buildStyled(_private::color_background[Color::cyan], std::move(text));
   }
 
   /**
-   * @brief Applies the red color to the background.
+   * @brief Applies the cyan color to the background.
    *
-   * This function applies the red color to the background.
+   * This function applies the cyan color to the background.
    *
-   * @param os The output stream to which the red color will be applied.
-   * @return The modified output stream with the red color applied.
+   * @param os The output stream to which the cyan color will be applied.
+   * @return The modified output stream with the cyan color applied.
   */
-  inline ostream& on_red(ostream& os){
-    os << _private::color_background["red"];
-    return os;
+  inline ostream& on_cyan(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::cyan);
   }
 
-  // Functions for bright red color
+  //Functions for bright cyan color
 
   /**
-   * @brief Applies the bright red color to the text or background based on the position.
+   * @brief Applies the bright cyan color to the text or background based on the position.
    *
-   * This function applies the bright red color to the specified position (either text or background),
+   * This function applies the bright cyan color to the specified position (either text or background),
    * depending on the value of the position parameter.
    *
    * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
    * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the bright red color applied.
-  */
+   * @return The modified output stream with the bright cyan color applied.
+   */
   template<uint8_t position>
-  ostream& bright_red(ostream& os){
+  ostream& bright_cyan(ostream& os){
     _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["bright red"] : _private::color_background["bright red"]);
-    return os;
+    return _private::applyColor(os, position, Color::bright_cyan);
   }
 
   /**
-   * @brief Applies the bright red color to the text based on the position.
+   * @brief Applies the bright cyan color to the text based on the position.
    *
-   * This function applies the bright red color to the specified position (either text or background),
+   * This function applies the bright cyan color to the specified position (either text or background),
    * depending on the value of the position parameter.
    *
    * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the bright red color will be applied.
-   * @return The modified text with the bright red color applied.
-  */
+   * @param text The text to which the bright cyan color will be applied.
+   * @return The modified text with the bright cyan color applied.
+   */
   template<uint8_t position>
-  string bright_red(const string& text) {
+  string bright_cyan(const string& text) {
     _private::checkPosition(position);
-    const string bright_red = (position == TEXT)? _private::color_text["bright red"] : _private::color_background["bright red"];
-    return bright_red + text + _private::RESET_STYLE;
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_cyan] : _private::color_background[Color::bright_cyan], text);
   }
 
   /**
-   * @brief Applies the bright red color to the text.
+   * @brief Applies the bright cyan color to the text based on the position.
    *
-   * This function applies the bright red color to the text.
+   * This function applies the bright cyan color to the specified position (either text or background),
+   * depending on the value of the position parameter.
    *
-   * @param text The text to which the bright red color will be applied.
-   * @return The modified text with the bright red color applied.
-  */
-  inline string bright_red(const string& text) {
-    const string bright_red = _private::color_text["bright red"];
-    return bright_red + text + _private::RESET_STYLE;
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright cyan color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright cyan color applied.
+   */
+  template<uint8_t position>
+  string bright_cyan(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_cyan] : _private::color_background[Color::bright_cyan], std::move(text));
   }
 
   /**
-   * @brief Applies the bright red color to the text.
+   * @brief Applies the bright cyan color to the text.
    *
-   * This function applies the bright red color to the text.
+   * This function applies the bright cyan color to the text.
    *
-   * @param os The output stream to which the bright red color will be applied.
-   * @return The modified output stream with the bright red color applied.
-  */
-  inline ostream& bright_red(ostream& os){
-    os << _private::color_text["bright red"];
-    return os;
+   * @param text The text to which the bright cyan color will be applied.
+   * @return The modified text with the bright cyan color applied.
+   */
+  inline string bright_cyan(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_cyan], text);
   }
 
   /**
-   * @brief Applies the bright red color to the background.
+   * @brief Applies the bright cyan color to the text.
    *
-   * This function applies the bright red color to the background.
+   * This function applies the bright cyan color to the text.
    *
-   * @param text The text to which the bright red color will be applied.
-   * @return The modified text with the bright red color applied.
-  */
-  inline string on_bright_red(const string& text){
-    const string bright_red = _private::color_background["bright red"];
-    return bright_red + text + _private::RESET_STYLE;
+   * @param text The text to which the bright cyan color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright cyan color applied.
+   */
+  inline string bright_cyan(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_cyan], std::move(text));
   }
 
   /**
-   * @brief Applies the bright red color to the background.
+   * @brief Applies the bright cyan color to the text.
    *
-   * This function applies the bright red color to the background.
+   * This function applies the bright cyan color to the text.
    *
-   * @param os The output stream to which the bright red color will be applied.
-   * @return The modified output stream with the bright red color applied.
-  */
-  inline ostream& on_bright_red(ostream& os){
-    os << _private::color_background["bright red"];
-    return os;
+   * @param os The output stream to which the bright cyan color will be applied.
+   * @return The modified output stream with the bright cyan color applied.
+   */
+  inline ostream& bright_cyan(ostream& os){
+    return _private::applyColor(os, TEXT, Color::bright_cyan);
   }
 
-  //Functions for the color green
-
   /**
-   * @brief Applies the green color to the text or background based on the position.
+   * @brief Applies the bright cyan color to the background.
    *
-   * This function applies the green color to the specified position (either text or background),
-   * depending on the value of the position parameter.
+   * This function applies the bright cyan color to the background.
    *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the green color applied.
-  */
-  template<uint8_t position>
-  ostream& green(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["green"] : _private::color_background["green"]);
-    return os;
+   * @param text The text to which the bright cyan color will be applied.
+   * @return The modified text with the bright cyan color applied.
+   */
+  inline string on_bright_cyan(const string& text){
+    return _private::buildStyled(_private::color_background[Color::bright_cyan], text);
   }
 
   /**
-   * @brief Applies the green color to the text based on the position.
+   * @brief Applies the bright cyan color to the background.
    *
-   * This function applies the green color to the specified position (either text or background),
-   * depending on the value of the position parameter.
+   * This function applies the bright cyan color to the background.
    *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the green color will be applied.
-   * @return The modified text with the green color applied.
-  */
-  template<uint8_t position>
-  string green(const string& text) {
-    _private::checkPosition(position);
-    const string green = (position == TEXT)? _private::color_text["green"] : _private::color_background["green"];
-    return green + text + _private::RESET_STYLE;
+   * @param text The text to which the bright cyan color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright cyan color applied.
+   */
+  inline string on_bright_cyan(string&& text){
+    return _private::buildStyled(_private::color_background[Color::bright_cyan], std::move(text));
   }
 
   /**
-   * @brief Applies the green color to the text.
+   * @brief Applies the bright cyan color to the background.
    *
-   * This function applies the green color to the text.
+   * This function applies the bright cyan color to the background.
    *
-   * @param text The text to which the green color will be applied.
-   * @return The modified text with the green color applied.
-  */
-  inline string green(const string& text) {
-    const string green = _private::color_text["green"];
-    return green + text + _private::RESET_STYLE;
+   * @param os The output stream to which the bright cyan color will be applied.
+   * @return The modified output stream with the bright cyan color applied.
+   */
+  inline ostream& on_bright_cyan(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::bright_cyan);
   }
 
+  // Functions for white color
   /**
-   * @brief Applies the green color to the text.
+   * @brief Applies the white color to the text or background based on the position.
    *
-   * This function applies the green color to the text.
+   * This function applies the white color to the specified position (either text or background),
+   * depending on the value of the position parameter.
    *
-   * @param os The output stream to which the green color will be applied.
-   * @return The modified output stream with the green color applied.
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param os The output stream to which the color will be applied.
+   * @return The modified output stream with the white color applied.
   */
-  inline ostream& green(ostream& os){
-    os << _private::color_text["green"];
-    return os;
+  template<uint8_t position>
+  ostream& white(ostream& os){
+    _private::checkPosition(position);
+    return _private::applyColor(os, position, Color::white);
   }
 
   /**
-   * @brief Applies the green color to the background.
+   * @brief Applies the white color to the text based on the position.
    *
-   * This function applies the green color to the background.
+   * This function applies the white color to the specified position (either text or background),
+   * depending on the value of the position parameter.
    *
-   * @param text The text to which the green color will be applied.
-   * @return The modified text with the green color applied.
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the white color will be applied.
+   * @return The modified text with the white color applied.
   */
-  inline string on_green(const string& text){
-    const string green = _private::color_background["green"];
-    return green + text + _private::RESET_STYLE;
+  template<uint8_t position>
+  string white(const string& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::white] : _private::color_background[Color::white], text);
   }
 
   /**
-   * @brief Applies the green color to the background.
+   * @brief Applies the white color to the text based on the position.
    *
-   * This function applies the green color to the background.
+   * This function applies the white color to the specified position (either text or background),
+   * depending on the value of the position parameter.
    *
-   * @param os The output stream to which the green color will be applied.
-   * @return The modified output stream with the green color applied.
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the white color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the white color applied.
   */
-  inline ostream& on_green(ostream& os){
-    os << _private::color_background["green"];
-    return os;
+  template<uint8_t position>
+  string white(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::white] : _private::color_background[Color::white], std::move(text));
   }
 
-  // Functions for bright green color
   /**
-   * @brief Applies the bright green color to the text or background based on the position.
+   * @brief Applies the white color to the text.
    *
-   * This function applies the bright green color to the specified position (either text or background),
-   * depending on the value of the position parameter.
+   * This function applies the white color to the text.
    *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the bright green color applied.
+   * @param text The text to which the white color will be applied.
+   * @return The modified text with the white color applied.
   */
-  template<uint8_t position>
-  ostream& bright_green(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["bright green"] : _private::color_background["bright green"]);
-    return os;
+  inline string white(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::white], text);
   }
 
   /**
-   * @brief Applies the bright green color to the text based on the position.
+   * @brief Applies the white color to the text.
    *
-   * This function applies the bright green color to the specified position (either text or background),
-   * depending on the value of the position parameter.
+   * This function applies the white color to the text.
    *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the bright green color will be applied.
-   * @return The modified text with the bright green color applied.
+   * @param text The text to which the white color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the white color applied.
   */
-  template<uint8_t position>
-  string bright_green(const string& text) {
-    _private::checkPosition(position);
-    const string bright_green = (position == TEXT)? _private::color_text["bright green"] : _private::color_background["bright green"];
-    return bright_green + text + _private::RESET_STYLE;
+  inline string white(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::white], std::move(text));
   }
 
   /**
-   * @brief Applies the bright green color to the text.
+   * @brief Applies the white color to the text.
    *
-   * This function applies the bright green color to the text.
+   * This function applies the white color to the text.
    *
-   * @param text The text to which the bright green color will be applied.
-   * @return The modified text with the bright green color applied.
+   * @param os The output stream to which the white color will be applied.
+   * @return The modified output stream with the white color applied.
   */
-  inline string bright_green(const string& text) {
-    const string bright_green = _private::color_text["bright green"];
-    return bright_green + text + _private::RESET_STYLE;
+  inline ostream& white(ostream& os){
+    return _private::applyColor(os, TEXT, Color::white);
   }
 
   /**
-   * @brief Applies the bright green color to the text.
+   * @brief Applies the white color to the background.
    *
-   * This function applies the bright green color to the text.
+   * This function applies the white color to the background.
    *
-   * @param os The output stream to which the bright green color will be applied.
-   * @return The modified output stream with the bright green color applied.
+   * @param text The text to which the white color will be applied.
+   * @return The modified text with the white color applied.
   */
-  inline ostream& bright_green(ostream& os){
-    os << _private::color_text["bright green"];
-    return os;
+  inline string on_white(const string& text){
+    return _private::buildStyled(_private::color_background[Color::white], text);
   }
 
   /**
-   * @brief Applies the bright green color to the background.
+   * @brief Applies the white color to the background.
    *
-   * This function applies the bright green color to the background.
+   * This function applies the white color to the background.
    *
-   * @param text The text to which the bright green color will be applied.
-   * @return The modified text with the bright green color applied.
+   * @param text The text to which the white color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the white color applied.
   */
-  inline string on_bright_green(const string& text){
-    const string bright_green = _private::color_background["bright green"];
-    return bright_green + text + _private::RESET_STYLE;
+  inline string on_white(string&& text){
+    return _private::buildStyled(_private::color_background[Color::white], std::move(text));
   }
 
   /**
-   * @brief Applies the bright green color to the background.
+   * @brief Applies the white color to the background.
    *
-   * This function applies the bright green color to the background.
+   * This function applies the white color to the background.
    *
-   * @param os The output stream to which the bright green color will be applied.
-   * @return The modified output stream with the bright green color applied.
+   * @param os The output stream to which the white color will be applied.
+   * @return The modified output stream with the white color applied.
   */
-  inline ostream& on_bright_green(ostream& os){
-    os << _private::color_background["bright green"];
-    return os;
+  inline ostream& on_white(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::white);
   }
 
-  // Functions for yellow color
+  //Functions for bright white color
+
   /**
-   * @brief Applies the yellow color to the text or background based on the position.
+   * @brief Applies the bright white color to the text or background based on the position.
    *
-   * This function applies the yellow color to the specified position (either text or background),
+   * This function applies the bright white color to the specified position (either text or background),
    * depending on the value of the position parameter.
    *
    * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
    * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the yellow color applied.
-  */
+   * @return The modified output stream with the bright white color applied.
+   */
   template<uint8_t position>
-  ostream& yellow(ostream& os){
+  ostream& bright_white(ostream& os){
     _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["yellow"] : _private::color_background["yellow"]);
-    return os;
+    return _private::applyColor(os, position, Color::bright_white);
   }
 
   /**
-   * @brief Applies the yellow color to the text based on the position.
+   * @brief Applies the bright white color to the text based on the position.
    *
-   * This function applies the yellow color to the specified position (either text or background),
+   * This function applies the bright white color to the specified position (either text or background),
    * depending on the value of the position parameter.
    *
    * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the yellow color will be applied.
-   * @return The modified text with the yellow color applied.
+   * @param text The text to which the bright white color will be applied.
+   * @return The modified text with the bright white color applied.
    */
   template<uint8_t position>
-  string yellow(const string& text) {
+  string bright_white(const string& text) {
     _private::checkPosition(position);
-    const string yellow = (position == TEXT)? _private::color_text["yellow"] : _private::color_background["yellow"];
-    return yellow + text + _private::RESET_STYLE;
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_white] : _private::color_background[Color::bright_white], text);
   }
 
   /**
-   * @brief Applies the yellow color to the text.
+   * @brief Applies the bright white color to the text based on the position.
    *
-   * This function applies the yellow color to the text.
+   * This function applies the bright white color to the specified position (either text or background),
+   * depending on the value of the position parameter.
    *
-   * @param text The text to which the yellow color will be applied.
-   * @return The modified text with the yellow color applied.
+   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
+   * @param text The text to which the bright white color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright white color applied.
    */
-  inline string yellow(const string& text) {
-    const string yellow = _private::color_text["yellow"];
-    return yellow + text + _private::RESET_STYLE;
+  template<uint8_t position>
+  string bright_white(string&& text) {
+    _private::checkPosition(position);
+    return _private::buildStyled((position == TEXT)? _private::color_text[Color::bright_white] : _private::color_background[Color::bright_white], std::move(text));
   }
 
   /**
-   * @brief Applies the yellow color to the text.
+   * @brief Applies the bright white color to the text.
    *
-   * This function applies the yellow color to the text.
+   * This function applies the bright white color to the text.
    *
-   * @param os The output stream to which the yellow color will be applied.
-   * @return The modified output stream with the yellow color applied.
+   * @param text The text to which the bright white color will be applied.
+   * @return The modified text with the bright white color applied.
    */
-  inline ostream& yellow(ostream& os){
-    os << _private::color_text["yellow"];
-    return os;
+  inline string bright_white(const string& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_white], text);
   }
 
   /**
-   * @brief Applies the yellow color to the background.
+   * @brief Applies the bright white color to the text.
    *
-   * This function applies the yellow color to the background.
+   * This function applies the bright white color to the text.
    *
-   * @param text The text to which the yellow color will be applied.
-   * @return The modified text with the yellow color applied.
+   * @param text The text to which the bright white color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright white color applied.
    */
-  inline string on_yellow(const string& text){
-    const string yellow = _private::color_background["yellow"];
-    return yellow + text + _private::RESET_STYLE;
+  inline string bright_white(string&& text) {
+    return _private::buildStyled(_private::color_text[Color::bright_white], std::move(text));
   }
 
   /**
-   * @brief Applies the yellow color to the background.
+   * @brief Applies the bright white color to the text.
    *
-   * This function applies the yellow color to the background.
+   * This function applies the bright white color to the text.
    *
-   * @param os The output stream to which the yellow color will be applied.
-   * @return The modified output stream with the yellow color applied.
+   * @param os The output stream to which the bright white color will be applied.
+   * @return The modified output stream with the bright white color applied.
    */
-  inline ostream& on_yellow(ostream& os){
-    os << _private::color_background["yellow"];
-    return os;
+  inline ostream& bright_white(ostream& os){
+    return _private::applyColor(os, TEXT, Color::bright_white);
   }
 
-  // Functions for bright yellow color
   /**
-   * @brief Applies the bright yellow color to the text or background based on the position.
+   * @brief Applies the bright white color to the background.
    *
-   * This function applies the bright yellow color to the specified position (either text or background),
-   * depending on the value of the position parameter.
+   * This function applies the bright white color to the background.
    *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the bright yellow color applied.
-  */
-  template<uint8_t position>
-  ostream& bright_yellow(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["bright yellow"] : _private::color_background["bright yellow"]);
-    return os;
+   * @param text The text to which the bright white color will be applied.
+   * @return The modified text with the bright white color applied.
+   */
+  inline string on_bright_white(const string& text){
+    return _private::buildStyled(_private::color_background[Color::bright_white], text);
   }
 
   /**
-   * @brief Applies the bright yellow color to the text based on the position.
+   * @brief Applies the bright white color to the background.
    *
-   * This function applies the bright yellow color to the specified position (either text or background),
-   * depending on the value of the position parameter.
+   * This function applies the bright white color to the background.
    *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the bright yellow color will be applied.
-   * @return The modified text with the bright yellow color applied.
-  */
-  template<uint8_t position>
-  string bright_yellow(const string& text) {
-    _private::checkPosition(position);
-    const string bright_yellow = (position == TEXT)? _private::color_text["bright yellow"] : _private::color_background["bright yellow"];
-    return bright_yellow + text + _private::RESET_STYLE;
+   * @param text The text to which the bright white color will be applied. Its buffer is reused for the returned string.
+   * @return The modified text with the bright white color applied.
+   */
+  inline string on_bright_white(string&& text){
+    return _private::buildStyled(_private::color_background[Color::bright_white], std::move(text));
   }
 
   /**
-   * @brief Applies the bright yellow color to the text.
+   * @brief Applies the bright white color to the background.
    *
-   * This function applies the bright yellow color to the text.
+   * This function applies the bright white color to the background.
    *
-   * @param text The text to which the bright yellow color will be applied.
-   * @return The modified text with the bright yellow color applied.
+   * @param os The output stream to which the bright white color will be applied.
+   * @return The modified output stream with the bright white color applied.
+   */
+  inline ostream& on_bright_white(ostream& os){
+    return _private::applyColor(os, BACKGROUND, Color::bright_white);
+  }
+
+  //Functions for bold style
+
+  /**
+   * @brief Applies bold style to the stream.
+   * 
+   * @param os The stream to apply the bold style to.
+   * 
+   * @return The modified stream.
   */
-  inline string bright_yellow(const string& text) {
-    const string bright_yellow = _private::color_text["bright yellow"];
-    return bright_yellow + text + _private::RESET_STYLE;
+  inline ostream& bold(ostream& os){
+    return _private::applyAttribute(os, Attribute::bold);
+  }
+  
+  /**
+   * @brief Applies bold style to the text.
+   * 
+   * @param text The text to apply the bold style to.
+   * 
+   * @return The modified text with bold style applied.
+  */
+  inline string bold(const string& text) {
+    return _private::buildStyled(_private::styles[Attribute::bold], text);
   }
 
   /**
-   * @brief Applies the bright yellow color to the text.
-   *
-   * This function applies the bright yellow color to the text.
-   *
-   * @param os The output stream to which the bright yellow color will be applied.
-   * @return The modified output stream with the bright yellow color applied.
+   * @brief Applies bold style to the text.
+   * 
+   * @param text The text to apply the bold style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with bold style applied.
   */
-  inline ostream& bright_yellow(ostream& os){
-    os << _private::color_text["bright yellow"];
-    return os;
+  inline string bold(string&& text) {
+    return _private::buildStyled(_private::styles[Attribute::bold], std::move(text));
+  }
+
+  //Functions for italic style
+
+  /**
+   * @brief Applies italic style to the stream.
+   * 
+   * @param os The stream to apply the italic style to.
+   * 
+   * @return The modified stream.
+  */
+  inline ostream& italic(ostream& os){
+    return _private::applyAttribute(os, Attribute::italic);
   }
 
   /**
-   * @brief Applies the bright yellow color to the background.
-   *
-   * This function applies the bright yellow color to the background.
-   *
-   * @param text The text to which the bright yellow color will be applied.
-   * @return The modified text with the bright yellow color applied.
+   * @brief Applies italic style to the text.
+   * 
+   * @param text The text to apply the italic style to.
+   * 
+   * @return The modified text with italic style applied.
+  */
+  inline string italic(const string& text) {
+    return _private::buildStyled(_private::styles[Attribute::italic], text);
+  }
+
+  /**
+   * @brief Applies italic style to the text.
+   * 
+   * @param text The text to apply the italic style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with italic style applied.
+  */
+  inline string italic(string&& text) {
+    return _private::buildStyled(_private::styles[Attribute::italic], std::move(text));
+  }
+
+  //Functions for underline style
+
+  /**
+   * @brief Applies underline style to the stream.
+   * 
+   * @param os The stream to apply the underline style to.
+   * 
+   * @return The modified stream.
+  */
+  inline ostream& underline(ostream& os){
+    return _private::applyAttribute(os, Attribute::underline);
+  }
+
+  /**
+   * @brief Applies underline style to the text.
+   * 
+   * @param text The text to apply the underline style to.
+   * 
+   * @return The modified text with underline style applied.
+  */
+  inline string underline(const string& text) { 
+    return _private::buildStyled(_private::styles[Attribute::underline], text);
+  }
+
+  /**
+   * @brief Applies underline style to the text.
+   * 
+   * @param text The text to apply the underline style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with underline style applied.
+  */
+  inline string underline(string&& text) { 
+    return _private::buildStyled(_private::styles[Attribute::underline], std::move(text));
+  }
+
+  //Functions for reverse style
+
+  /**
+   * @brief Applies reverse style to the stream.
+   * 
+   * @param os The stream to apply the reverse style to.
+   * 
+   * @return The modified stream.
+  */
+  inline ostream& reverse(ostream& os){
+    return _private::applyAttribute(os, Attribute::reverse);
+  }
+
+  /**
+   * @brief Applies reverse style to the text.
+   * 
+   * @param text The text to apply the reverse style to.
+   * 
+   * @return The modified text with reverse style applied.
   */
-  inline string on_bright_yellow(const string& text){
-    const string bright_yellow = _private::color_background["bright yellow"];
-    return bright_yellow + text + _private::RESET_STYLE;
+  inline string reverse(const string& text) { 
+    return _private::buildStyled(_private::styles[Attribute::reverse], text);
   }
 
   /**
-   * @brief Applies the bright yellow color to the background.
-   *
-   * This function applies the bright yellow color to the background.
-   *
-   * @param os The output stream to which the bright yellow color will be applied.
-   * @return The modified output stream with the bright yellow color applied.
+   * @brief Applies reverse style to the text.
+   * 
+   * @param text The text to apply the reverse style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with reverse style applied.
   */
-  inline ostream& on_bright_yellow(ostream& os){
-    os << _private::color_background["bright yellow"];
-    return os;
+  inline string reverse(string&& text) { 
+    return _private::buildStyled(_private::styles[Attribute::reverse], std::move(text));
   }
 
-  // Functions for blue color
+  //Functions for dim style
+
   /**
-   * @brief Applies the blue color to the text or background based on the position.
-   *
-   * This function applies the blue color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the blue color applied.
+   * @brief Applies dim style to the stream.
+   * 
+   * @param os The stream to apply the dim style to.
+   * 
+   * @return The modified stream.
   */
-  template<uint8_t position>
-  ostream& blue(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["blue"] : _private::color_background["blue"]);
-    return os;
+  inline ostream& dim(ostream& os){
+    return _private::applyAttribute(os, Attribute::dim);
   }
-
+  
   /**
-   * @brief Applies the blue color to the text based on the position.
-   *
-   * This function applies the blue color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the blue color will be applied.
-   * @return The modified text with the blue color applied.
+   * @brief Applies dim style to the text.
+   * 
+   * @param text The text to apply the dim style to.
+   * 
+   * @return The modified text with dim style applied.
   */
-  template<uint8_t position>
-  string blue(const string& text) {
-    _private::checkPosition(position);
-    const string blue = (position == TEXT)? _private::color_text["blue"] : _private::color_background["blue"];
-    return blue + text + _private::RESET_STYLE;
+  inline string dim(const string& text) {
+    return _private::buildStyled(_private::styles[Attribute::dim], text);
   }
 
   /**
-   * @brief Applies the blue color to the text.
-   *
-   * This function applies the blue color to the text.
-   *
-   * @param text The text to which the blue color will be applied.
-   * @return The modified text with the blue color applied.
+   * @brief Applies dim style to the text.
+   * 
+   * @param text The text to apply the dim style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with dim style applied.
   */
-  inline string blue(const string& text) {
-    const string blue = _private::color_text["blue"];
-    return blue + text + _private::RESET_STYLE;
+  inline string dim(string&& text) {
+    return _private::buildStyled(_private::styles[Attribute::dim], std::move(text));
   }
 
+  //Functions for blink style
+
   /**
-   * @brief Applies the blue color to the text.
-   *
-   * This function applies the blue color to the text.
-   *
-   * @param os The output stream to which the blue color will be applied.
-   * @return The modified output stream with the blue color applied.
+   * @brief Applies blink style to the stream.
+   * 
+   * @param os The stream to apply the blink style to.
+   * 
+   * @return The modified stream.
   */
-  inline ostream& blue(ostream& os){
-    os << _private::color_text["blue"];
-    return os;
+  inline ostream& blink(ostream& os){
+    return _private::applyAttribute(os, Attribute::blink);
   }
-
+  
   /**
-   * @brief Applies the blue color to the background.
-   *
-   * This function applies the blue color to the background.
-   *
-   * @param text The text to which the blue color will be applied.
-   * @return The modified text with the blue color applied.
+   * @brief Applies blink style to the text.
+   * 
+   * @param text The text to apply the blink style to.
+   * 
+   * @return The modified text with blink style applied.
   */
-  inline string on_blue(const string& text){
-    const string blue = _private::color_background["blue"];
-    return blue + text + _private::RESET_STYLE;
+  inline string blink(const string& text) {
+    return _private::buildStyled(_private::styles[Attribute::blink], text);
   }
 
   /**
-   * @brief Applies the blue color to the background.
-   *
-   * This function applies the blue color to the background.
-   *
-   * @param os The output stream to which the blue color will be applied.
-   * @return The modified output stream with the blue color applied.
+   * @brief Applies blink style to the text.
+   * 
+   * @param text The text to apply the blink style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with blink style applied.
   */
-  inline ostream& on_blue(ostream& os){
-    os << _private::color_background["blue"];
-    return os;
+  inline string blink(string&& text) {
+    return _private::buildStyled(_private::styles[Attribute::blink], std::move(text));
   }
 
-  // Functions for bright blue color
+  //Functions for conceal style
+
   /**
-   * @brief Applies the bright blue color to the text or background based on the position.
-   *
-   * This function applies the bright blue color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the bright blue color applied.
+   * @brief Applies conceal style to the stream.
+   * 
+   * @param os The stream to apply the conceal style to.
+   * 
+   * @return The modified stream.
   */
-  template<uint8_t position>
-  ostream& bright_blue(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["bright blue"] : _private::color_background["bright blue"]);
-    return os;
+  inline ostream& conceal(ostream& os){
+    return _private::applyAttribute(os, Attribute::conceal);
   }
-
+  
   /**
-   * @brief Applies the bright blue color to the text based on the position.
-   *
-   * This function applies the bright blue color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the bright blue color will be applied.
-   * @return The modified text with the bright blue color applied.
+   * @brief Applies conceal style to the text.
+   * 
+   * @param text The text to apply the conceal style to.
+   * 
+   * @return The modified text with conceal style applied.
   */
-  template<uint8_t position>
-  string bright_blue(const string& text) {
-    _private::checkPosition(position);
-    const string bright_blue = (position == TEXT)? _private::color_text["bright blue"] : _private::color_background["bright blue"];
-    return bright_blue + text + _private::RESET_STYLE;
+  inline string conceal(const string& text) {
+    return _private::buildStyled(_private::styles[Attribute::conceal], text);
   }
 
   /**
-   * @brief Applies the bright blue color to the text.
-   *
-   * This function applies the bright blue color to the text.
-   *
-   * @param text The text to which the bright blue color will be applied.
-   * @return The modified text with the bright blue color applied.
+   * @brief Applies conceal style to the text.
+   * 
+   * @param text The text to apply the conceal style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with conceal style applied.
   */
-  inline string bright_blue(const string& text) {
-    const string bright_blue = _private::color_text["bright blue"];
-    return bright_blue + text + _private::RESET_STYLE;
+  inline string conceal(string&& text) {
+    return _private::buildStyled(_private::styles[Attribute::conceal], std::move(text));
   }
 
+  //Functions for strikethrough style
+
   /**
-   * @brief Applies the bright blue color to the text.
-   *
-   * This function applies the bright blue color to the text.
-   *
-   * @param os The output stream to which the bright blue color will be applied.
-   * @return The modified output stream with the bright blue color applied.
+   * @brief Applies strikethrough style to the stream.
+   * 
+   * @param os The stream to apply the strikethrough style to.
+   * 
+   * @return The modified stream.
   */
-  inline ostream& bright_blue(ostream& os){
-    os << _private::color_text["bright blue"];
-    return os;
+  inline ostream& strikethrough(ostream& os){
+    return _private::applyAttribute(os, Attribute::strikethrough);
   }
-
+  
   /**
-   * @brief Applies the bright blue color to the background.
-   *
-   * This function applies the bright blue color to the background.
-   *
-   * @param text The text to which the bright blue color will be applied.
-   * @return The modified text with the bright blue color applied.
+   * @brief Applies strikethrough style to the text.
+   * 
+   * @param text The text to apply the strikethrough style to.
+   * 
+   * @return The modified text with strikethrough style applied.
   */
-  inline string on_bright_blue(const string& text){
-    const string bright_blue = _private::color_background["bright blue"];
-    return bright_blue + text + _private::RESET_STYLE;
+  inline string strikethrough(const string& text) {
+    return _private::buildStyled(_private::styles[Attribute::strikethrough], text);
   }
 
   /**
-   * @brief Applies the bright blue color to the background.
-   *
-   * This function applies the bright blue color to the background.
-   *
-   * @param os The output stream to which the bright blue color will be applied.
-   * @return The modified output stream with the bright blue color applied.
+   * @brief Applies strikethrough style to the text.
+   * 
+   * @param text The text to apply the strikethrough style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with strikethrough style applied.
   */
-  inline ostream& on_bright_blue(ostream& os){
-    os << _private::color_background["bright blue"];
-    return os;
+  inline string strikethrough(string&& text) {
+    return _private::buildStyled(_private::styles[Attribute::strikethrough], std::move(text));
   }
 
-  // Functions for magenta color
+  //Functions for double underline style
+
   /**
-   * @brief Applies the magenta color to the text or background based on the position.
-   *
-   * This function applies the magenta color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the magenta color applied.
+   * @brief Applies double underline style to the stream.
+   * 
+   * @param os The stream to apply the double underline style to.
+   * 
+   * @return The modified stream.
   */
-  template<uint8_t position>
-  ostream& magenta(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["magenta"] : _private::color_background["magenta"]);
-    return os;
+  inline ostream& double_underline(ostream& os){
+    return _private::applyAttribute(os, Attribute::double_underline);
   }
-
+  
   /**
-   * @brief Applies the magenta color to the text based on the position.
-   *
-   * This function applies the magenta color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the magenta color will be applied.
-   * @return The modified text with the magenta color applied.
+   * @brief Applies double underline style to the text.
+   * 
+   * @param text The text to apply the double underline style to.
+   * 
+   * @return The modified text with double underline style applied.
   */
-  template<uint8_t position>
-  string magenta(const string& text) {
-    _private::checkPosition(position);
-    const string magenta = (position == TEXT)? _private::color_text["magenta"] : _private::color_background["magenta"];
-    return magenta + text + _private::RESET_STYLE;
+  inline string double_underline(const string& text) {
+    return _private::buildStyled(_private::styles[Attribute::double_underline], text);
   }
 
   /**
-   * @brief Applies the magenta color to the text.
-   *
-   * This function applies the magenta color to the text.
-   *
-   * @param text The text to which the magenta color will be applied.
-   * @return The modified text with the magenta color applied.
+   * @brief Applies double underline style to the text.
+   * 
+   * @param text The text to apply the double underline style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with double underline style applied.
   */
-  inline string magenta(const string& text) {
-    const string magenta = _private::color_text["magenta"];
-    return magenta + text + _private::RESET_STYLE;
+  inline string double_underline(string&& text) {
+    return _private::buildStyled(_private::styles[Attribute::double_underline], std::move(text));
   }
 
+  //Functions for curly underline style
+
   /**
-   * @brief Applies the magenta color to the text.
-   *
-   * This function applies the magenta color to the text.
-   *
-   * @param os The output stream to which the magenta color will be applied.
-   * @return The modified output stream with the magenta color applied.
+   * @brief Applies curly underline style to the stream.
+   * 
+   * @param os The stream to apply the curly underline style to.
+   * 
+   * @return The modified stream.
   */
-  inline ostream& magenta(ostream& os){
-    os << _private::color_text["magenta"];
-    return os;
+  inline ostream& curly_underline(ostream& os){
+    return _private::applyAttribute(os, Attribute::curly_underline);
   }
-
+  
   /**
-   * @brief Applies the magenta color to the background.
-   *
-   * This function applies the magenta color to the background.
-   *
-   * @param text The text to which the magenta color will be applied.
-   * @return The modified text with the magenta color applied.
+   * @brief Applies curly underline style to the text.
+   * 
+   * @param text The text to apply the curly underline style to.
+   * 
+   * @return The modified text with curly underline style applied.
   */
-  inline string on_magenta(const string& text){
-    const string magenta = _private::color_background["magenta"];
-    return magenta + text + _private::RESET_STYLE;
+  inline string curly_underline(const string& text) {
+    return _private::buildStyled(_private::styles[Attribute::curly_underline], text);
   }
 
   /**
-   * @brief Applies the magenta color to the background.
-   *
-   * This function applies the magenta color to the background.
-   *
-   * @param os The output stream to which the magenta color will be applied.
-   * @return The modified output stream with the magenta color applied.
+   * @brief Applies curly underline style to the text.
+   * 
+   * @param text The text to apply the curly underline style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with curly underline style applied.
   */
-  inline ostream& on_magenta(ostream& os){
-    os << _private::color_background["magenta"];
-    return os;
+  inline string curly_underline(string&& text) {
+    return _private::buildStyled(_private::styles[Attribute::curly_underline], std::move(text));
   }
 
-  // Functions for bright magenta color
+  //Functions for overline style
+
   /**
-   * @brief Applies the bright magenta color to the text or background based on the position.
-   *
-   * This function applies the bright magenta color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the bright magenta color applied.
+   * @brief Applies overline style to the stream.
+   * 
+   * @param os The stream to apply the overline style to.
+   * 
+   * @return The modified stream.
+  */
+  inline ostream& overline(ostream& os){
+    return _private::applyAttribute(os, Attribute::overline);
+  }
+  
+  /**
+   * @brief Applies overline style to the text.
+   * 
+   * @param text The text to apply the overline style to.
+   * 
+   * @return The modified text with overline style applied.
   */
-  template<uint8_t position>
-  ostream& bright_magenta(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["bright magenta"] : _private::color_background["bright magenta"]);
-    return os;
+  inline string overline(const string& text) {
+    return _private::buildStyled(_private::styles[Attribute::overline], text);
   }
 
   /**
-   * @brief Applies the bright magenta color to the text based on the position.
-   *
-   * This function applies the bright magenta color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the bright magenta color will be applied.
-   * @return The modified text with the bright magenta color applied.
+   * @brief Applies overline style to the text.
+   * 
+   * @param text The text to apply the overline style to. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with overline style applied.
   */
-  template<uint8_t position>
-  string bright_magenta(const string& text) {
-    _private::checkPosition(position);
-    const string bright_magenta = (position == TEXT)? _private::color_text["bright magenta"] : _private::color_background["bright magenta"];
-    return bright_magenta + text + _private::RESET_STYLE;
+  inline string overline(string&& text) {
+    return _private::buildStyled(_private::styles[Attribute::overline], std::move(text));
   }
 
+  //Functions for reset style
+
   /**
-   * @brief Applies the bright magenta color to the text.
-   *
-   * This function applies the bright magenta color to the text.
-   *
-   * @param text The text to which the bright magenta color will be applied.
-   * @return The modified text with the bright magenta color applied.
+   * @brief Resets the stream to the default style.
+   * 
+   * Nothing is written when no style was applied to the stream by the library.
+   * 
+   * @param os The stream to reset.
+   * @return The modified stream with the default style.
   */
-  inline string bright_magenta(const string& text) {
-    const string bright_magenta = _private::color_text["bright magenta"];
-    return bright_magenta + text + _private::RESET_STYLE;
+  inline ostream& reset(ostream& os){
+    return _private::resetStream(os);
   }
 
   /**
-   * @brief Applies the bright magenta color to the text.
-   *
-   * This function applies the bright magenta color to the text.
-   *
-   * @param os The output stream to which the bright magenta color will be applied.
-   * @return The modified output stream with the bright magenta color applied.
+   * @brief Resets the text to the default style.
+   * 
+   * @param text The text to reset.
+   * @return The modified text with the default style.
   */
-  inline ostream& bright_magenta(ostream& os){
-    os << _private::color_text["bright magenta"];
-    return os;
+  inline string reset(const string& text){
+    return _private::buildStyled({}, text);
   }
 
   /**
-   * @brief Applies the bright magenta color to the background.
-   *
-   * This function applies the bright magenta color to the background.
-   *
-   * @param text The text to which the bright magenta color will be applied.
-   * @return The modified text with the bright magenta color applied.
+   * @brief Resets the text to the default style.
+   * 
+   * @param text The text to reset. Its buffer is reused for the returned string.
+   * @return The modified text with the default style.
   */
-  inline string on_bright_magenta(const string& text){
-    const string bright_magenta = _private::color_background["bright magenta"];
-    return bright_magenta + text + _private::RESET_STYLE;
+  inline string reset(string&& text){
+    return _private::buildStyled({}, std::move(text));
   }
 
+  //Functions for combined styles
+
   /**
-   * @brief Applies the bright magenta color to the background.
-   *
-   * This function applies the bright magenta color to the background.
-   *
-   * @param os The output stream to which the bright magenta color will be applied.
-   * @return The modified output stream with the bright magenta color applied.
+   * @brief Applies a combined style to the stream with a single escape code.
+   * 
+   * @param os The stream to apply the style to.
+   * @param style The style to apply.
+   * 
+   * @return The modified stream.
   */
-  inline ostream& on_bright_magenta(ostream& os){
-    os << _private::color_background["bright magenta"];
-    return os;
+  inline ostream& operator<<(ostream& os, const Style& style) {
+    return _private::applyToStream(os, style, _private::cachedStyle(style, _private::streamDepth(os)));
   }
 
-  // Functions for cyan color
   /**
-   * @brief Applies the cyan color to the text or background based on the position.
-   *
-   * This function applies the cyan color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the cyan color applied.
+   * @brief Applies a combined style to the text with a single escape code.
+   * 
+   * @param style The style to apply.
+   * @param text The text to style.
+   * 
+   * @return The modified text with the style applied.
   */
-  template<uint8_t position>
-  ostream& cyan(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["cyan"] : _private::color_background["cyan"]);
-    return os;
+  inline string style(const Style& style, const string& text) {
+    return _private::buildStyled(_private::cachedStyle(style, _private::outputDepth()), text);
   }
 
   /**
-   * @brief Applies the cyan color to the text based on the position.
-   *
-   * This function applies the cyan color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the cyan color will be applied.
-   * @return The modified text with the cyan color applied.
+   * @brief Applies a combined style to the text with a single escape code.
+   * 
+   * @param style The style to apply.
+   * @param text The text to style. Its buffer is reused for the returned string.
+   * 
+   * @return The modified text with the style applied.
   */
-  template<uint8_t position>
-  string cyan(const string& text) {
-    _private::checkPosition(position);
-    const string cyan = (position == TEXT)? _private::color_text["cyan"] : _private::color_background["cyan"];
-    return cyan + text + _private::RESET_STYLE;
+  inline string style(const Style& style, string&& text) {
+    return _private::buildStyled(_private::cachedStyle(style, _private::outputDepth()), std::move(text));
   }
 
+  //Functions for per-stream coloring
+
   /**
-   * @brief Applies the cyan color to the text.
-   *
-   * This function applies the cyan color to the text.
-   *
-   * @param text The text to which the cyan color will be applied.
-   * @return The modified text with the cyan color applied.
+   * @brief Disables the colors and styles on the stream, every library function will write nothing to it.
+   * 
+   * Useful for streams redirected to files, where the escape codes would only add noise.
+   * 
+   * @param os The stream to disable the colors on.
+   * 
+   * @return The modified stream.
   */
-  inline string cyan(const string& text) {
-    const string cyan = _private::color_text["cyan"];
-    return cyan + text + _private::RESET_STYLE;
+  inline ostream& disable_colors(ostream& os) {
+    os.iword(_private::streamSlots().flags) = _private::STREAM_COLORS_DISABLED;
+    return os;
   }
 
   /**
-   * @brief Applies the cyan color to the text.
-   *
-   * This function applies the cyan color to the text.
-   *
-   * @param os The output stream to which the cyan color will be applied.
-   * @return The modified output stream with the cyan color applied.
+   * @brief Enables the colors and styles on the stream, even when its output was detected as not able to show them.
+   * 
+   * @param os The stream to enable the colors on.
+   * 
+   * @return The modified stream.
   */
-  inline ostream& cyan(ostream& os){
-    os << _private::color_text["cyan"];
+  inline ostream& enable_colors(ostream& os) {
+    os.iword(_private::streamSlots().flags) = _private::STREAM_COLORS_ENABLED;
     return os;
   }
 
   /**
-   * @brief Applies the cyan color to the background.
-   *
-   * This function applies the cyan color to the background.
-   *
-   * @param text The text to which the cyan color will be applied.
-   * @return The modified text with the cyan color applied.
+   * @brief Checks if the library writes colors and styles to the stream.
+   * 
+   * @param os The stream to check.
+   * 
+   * @return True if the colors are enabled on the stream.
   */
-  inline string on_cyan(const string& text){
-    const string cyan = _private::color_background["cyan"];
-    return cyan + text + _private::RESET_STYLE;
+  inline bool colors_enabled(ostream& os) {
+    return _private::streamColorsEnabled(os);
   }
 
   /**
-   * @brief Applies the cyan color to the background.
-   *
-   * This function applies the cyan color to the background.
-   *
-   * @param os The output stream to which the cyan color will be applied.
-   * @return The modified output stream with the cyan color applied.
+   * @brief Returns the style currently applied to the stream by the library functions.
+   * 
+   * @param os The stream to check.
+   * 
+   * @return The applied style, empty after a reset.
   */
-  inline ostream& on_cyan(ostream& os){
-    os << _private::color_background["cyan"];
-    return os;
+  inline Style current_style(ostream& os) {
+    return _private::streamStyle(os);
   }
 
-  //Functions for bright cyan color
+  //Functions for style-diff emission
 
   /**
-   * @brief Applies the bright cyan color to the text or background based on the position.
-   *
-   * This function applies the bright cyan color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the bright cyan color applied.
-   */
-  template<uint8_t position>
-  ostream& bright_cyan(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["bright cyan"] : _private::color_background["bright cyan"]);
-    return os;
-  }
+   * @brief Writes consecutive styled spans to a stream, emitting only the changes between their styles.
+   * 
+   * Instead of wrapping every span in its own escape code and reset, it remembers the current style
+   * and sends the minimal escape code to reach the next one, with a single reset at the end.
+   * 
+   * Example:
+   *   StyleEmitter emitter(cout);
+   *   emitter.write(fg(Color::red), "error ").write(fg(Color::red) | Attribute::bold, "42");
+   *   emitter.finish();
+  */
+  class StyleEmitter {
+  public:
+    explicit StyleEmitter(ostream& os) : os(os), current(_private::streamStyle(os)) {}
 
-  /**
-   * @brief Applies the bright cyan color to the text based on the position.
-   *
-   * This function applies the bright cyan color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the bright cyan color will be applied.
-   * @return The modified text with the bright cyan color applied.
-   */
-  template<uint8_t position>
-  string bright_cyan(const string& text) {
-    _private::checkPosition(position);
-    const string bright_cyan = (position == TEXT)? _private::color_text["bright cyan"] : _private::color_background["bright cyan"];
-    return bright_cyan + text + _private::RESET_STYLE;
-  }
+    StyleEmitter(const StyleEmitter&) = delete;
+    StyleEmitter& operator=(const StyleEmitter&) = delete;
+
+    //Resets the stream if a style is still applied.
+    ~StyleEmitter() {
+      finish();
+    }
+
+    /**
+     * @brief Changes the style of the following text.
+     * 
+     * @param style The style to apply.
+     * 
+     * @return The emitter, to chain more calls.
+    */
+    StyleEmitter& apply(const Style& style) {
+      if (_private::streamColorsEnabled(os)) {
+        const auto delta = _private::makeStyleDelta(current, style, _private::streamDepth(os));
+        if (delta.length != 0) os << delta.view();
+        Style rendered = style;
+        rendered.attributes = _private::renderedAttributes(rendered);
+        _private::setStreamStyle(os, rendered);
+      }
+      current = style;
+      return *this;
+    }
+
+    /**
+     * @brief Writes a span of text with the given style.
+     * 
+     * @param style The style of the text.
+     * @param text The text to write.
+     * 
+     * @return The emitter, to chain more calls.
+    */
+    StyleEmitter& write(const Style& style, std::string_view text) {
+      apply(style);
+      os << text;
+      return *this;
+    }
+
+    /**
+     * @brief Writes a span of text with the current style.
+     * 
+     * @param text The text to write.
+     * 
+     * @return The emitter, to chain more calls.
+    */
+    StyleEmitter& write(std::string_view text) {
+      os << text;
+      return *this;
+    }
+
+    /**
+     * @brief Resets the stream to the default style, only if a style is applied.
+    */
+    void finish() {
+      if (current.empty()) return;
+      reset(os);
+      current = Style();
+    }
+
+    //Returns the style applied to the following text.
+    const Style& style() const {
+      return current;
+    }
+
+  private:
+    ostream& os;
+    Style current;
+  };
+
+  //Functions for buffered output
+
+  //When a Writer sends its buffer to the file descriptor.
+  enum class FlushPolicy {
+    full,    //Only when the buffer is full, when flush() is called and when the writer is destroyed
+    newline, //After every write that contains a newline
+    manual   //Only when flush() is called and when the writer is destroyed, a full buffer still has to be written
+  };
 
   /**
-   * @brief Applies the bright cyan color to the text.
-   *
-   * This function applies the bright cyan color to the text.
-   *
-   * @param text The text to which the bright cyan color will be applied.
-   * @return The modified text with the bright cyan color applied.
-   */
-  inline string bright_cyan(const string& text) {
-    const string bright_cyan = _private::color_text["bright cyan"];
-    return bright_cyan + text + _private::RESET_STYLE;
-  }
+   * @brief Writes styled text to a file descriptor through a fixed-size buffer, without going through std::ostream.
+   * 
+   * Styles are applied like in StyleEmitter, sending only the changes between them, and they use the capability
+   * of the file descriptor. The buffer is sent with write(2) according to the flush policy.
+   * With CLISTYLE_USE_IO_URING defined on Linux, a full buffer is sent through io_uring while the text goes into a second one,
+   * flush() still writes with write(2) once that write is done.
+   * A Writer isn't thread safe, every thread should use its own.
+   * 
+   * Example:
+   *   Writer out(1, FlushPolicy::newline);
+   *   out << fg(Color::red) << "error " << 42 << Style() << "\n";
+  */
+  class Writer {
+  public:
+    /**
+     * @param fd The file descriptor to write to, the standard output by default.
+     * @param policy When to send the buffer to the file descriptor.
+     * @param capacity The size of the buffer, allocated once.
+    */
+    explicit Writer(int fd = 1, FlushPolicy policy = FlushPolicy::full, std::size_t capacity = 8192)
+      : buffer(new char[capacity == 0 ? 1 : capacity]), capacity(capacity == 0 ? 1 : capacity), fd(fd), policy(policy),
+        depth(_private::fdColorDepth(fd)) {
+      #ifdef CLISTYLE_IO_URING
+      //The buffer is filled while the other one is written, so a second one is needed
+      spare.reset(new char[this->capacity]);
+      if (!ring.open(buffer.get(), spare.get(), this->capacity)) spare.reset();
+      #endif
+    }
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    //Resets the style if one is applied and sends what's left in the buffer.
+    ~Writer() {
+      reset();
+      flush();
+    }
+
+    /**
+     * @brief Changes the style of the following text, appending only the changes from the current style.
+     * 
+     * @param style The style to apply.
+     * 
+     * @return The writer, to chain more calls.
+    */
+    Writer& apply(const Style& style) {
+      if (depth != ColorDepth::none && style != current) {
+        if (style.empty()) append(_private::RESET_STYLE);
+        else if (current.empty()) append(_private::cachedStyle(style, depth)); //Nothing to undo, the full code is cached
+        else append(_private::makeStyleDelta(current, style, depth).view());
+      }
+      current = style;
+      return *this;
+    }
+
+    /**
+     * @brief Writes text with the current style.
+     * 
+     * @param text The text to write.
+     * 
+     * @return The writer, to chain more calls.
+    */
+    Writer& write(std::string_view text) {
+      append(text);
+      if (policy == FlushPolicy::newline && text.find('\n') != std::string_view::npos) flush();
+      return *this;
+    }
+
+    /**
+     * @brief Writes text with the given style, that stays applied to the following text.
+     * 
+     * @param style The style of the text.
+     * @param text The text to write.
+     * 
+     * @return The writer, to chain more calls.
+    */
+    Writer& write(const Style& style, std::string_view text) {
+      apply(style);
+      return write(text);
+    }
+
+    //Goes back to the default style, only if a style is applied.
+    Writer& reset() {
+      return apply(Style());
+    }
+
+    /**
+     * @brief Sends the buffer to the file descriptor.
+     * 
+     * It reports every write made since the previous call, including the ones made when the buffer was full.
+     * 
+     * @return False when the file descriptor reported an error for any of them.
+    */
+    bool flush() {
+      send();
+      const bool written = !failed;
+      failed = false;
+      return written;
+    }
+
+    //Returns the style applied to the following text.
+    const Style& style() const {
+      return current;
+    }
+
+    //Returns the capability of the file descriptor, used to encode the styles.
+    ColorDepth color_depth() const {
+      return depth;
+    }
+
+  private:
+    //Sends the buffer with write(2), remembering a failure until flush() reports it.
+    void send() {
+      #ifdef CLISTYLE_IO_URING
+      //A write that must be done on return is cheaper with write(2), the ring only overlaps the full buffers
+      if (!ring.wait()) failed = true;
+      #endif
+      if (length == 0) return;
+      if (!_private::writeAll(fd, buffer.get(), length)) failed = true;
+      length = 0;
+    }
+
+    //Copies into the buffer, sending it when it's full. Text larger than the buffer is sent directly along with the buffer.
+    void append(std::string_view text) {
+      if (text.size() > capacity - length) {
+        if (text.size() > capacity) {
+          #ifdef CLISTYLE_IO_URING
+          if (!ring.wait()) failed = true; //The write in flight goes first
+          #endif
+          _private::IoVector parts[2] = {{buffer.get(), length}, {const_cast<char*>(text.data()), text.size()}};
+          if (!_private::writeVectors(fd, length == 0 ? parts + 1 : parts, length == 0 ? 1 : 2)) failed = true;
+          length = 0;
+          return;
+        }
+        #ifdef CLISTYLE_IO_URING
+        if (ring.available()) { //Without waiting, the next text goes into the other buffer
+          if (!submit()) failed = true;
+        }
+        else send();
+        #else
+        send();
+        #endif
+      }
+      std::memcpy(buffer.get() + length, text.data(), text.size());
+      length += text.size();
+    }
+
+    #ifdef CLISTYLE_IO_URING
+    //Hands the buffer to the ring and continues in the other one.
+    bool submit() {
+      if (length == 0) return true;
+      const bool written = ring.submit(fd, active, buffer.get(), length);
+      buffer.swap(spare);
+      active ^= 1;
+      length = 0;
+      return written;
+    }
+    #endif
 
-  /**
-   * @brief Applies the bright cyan color to the text.
-   *
-   * This function applies the bright cyan color to the text.
-   *
-   * @param os The output stream to which the bright cyan color will be applied.
-   * @return The modified output stream with the bright cyan color applied.
-   */
-  inline ostream& bright_cyan(ostream& os){
-    os << _private::color_text["bright cyan"];
-    return os;
+    std::unique_ptr<char[]> buffer;
+    std::size_t capacity;
+    std::size_t length = 0;
+    int fd;
+    FlushPolicy policy;
+    ColorDepth depth;
+    Style current;
+    bool failed = false; //Set by a failed write, until flush() reports it
+    #ifdef CLISTYLE_IO_URING
+    std::unique_ptr<char[]> spare;
+    unsigned active = 0; //The registered index of the buffer being filled
+    _private::UringQueue ring; //Last, so its pending write ends before the buffers are freed
+    #endif
+  };
+
+  //Writes text with the current style of the writer.
+  inline Writer& operator<<(Writer& writer, std::string_view text) {
+    return writer.write(text);
   }
 
-  /**
-   * @brief Applies the bright cyan color to the background.
-   *
-   * This function applies the bright cyan color to the background.
-   *
-   * @param text The text to which the bright cyan color will be applied.
-   * @return The modified text with the bright cyan color applied.
-   */
-  inline string on_bright_cyan(const string& text){
-    const string bright_cyan = _private::color_background["bright cyan"];
-    return bright_cyan + text + _private::RESET_STYLE;
+  //Writes a single character with the current style of the writer.
+  inline Writer& operator<<(Writer& writer, char character) {
+    return writer.write(std::string_view(&character, 1));
   }
 
-  /**
-   * @brief Applies the bright cyan color to the background.
-   *
-   * This function applies the bright cyan color to the background.
-   *
-   * @param os The output stream to which the bright cyan color will be applied.
-   * @return The modified output stream with the bright cyan color applied.
-   */
-  inline ostream& on_bright_cyan(ostream& os){
-    os << _private::color_background["bright cyan"];
-    return os;
+  //Changes the style of the following text written by the writer.
+  inline Writer& operator<<(Writer& writer, const Style& style) {
+    return writer.apply(style);
   }
 
-  // Functions for white color
-  /**
-   * @brief Applies the white color to the text or background based on the position.
-   *
-   * This function applies the white color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the white color applied.
-  */
-  template<uint8_t position>
-  ostream& white(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["white"] : _private::color_background["white"]);
-    return os;
+  //Writes the decimal text of an integer, formatted without allocating.
+  template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>>>
+  Writer& operator<<(Writer& writer, T number) {
+    char digits[24];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), number);
+    return writer.write(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
   }
 
+  //Functions for scatter-gather output
+
   /**
-   * @brief Applies the white color to the text based on the position.
-   *
-   * This function applies the white color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the white color will be applied.
-   * @return The modified text with the white color applied.
+   * @brief Writes a styled text to a file descriptor without joining the escape code, the text and the reset style.
+   * 
+   * The three parts are sent with a single writev call, so a large text is never copied.
+   * 
+   * @param fd The file descriptor to write to.
+   * @param style The style of the text.
+   * @param text The text to write.
+   * @param depth The color depth used to encode the style, with none only the text is written.
+   * 
+   * @return False when the file descriptor reported an error.
   */
-  template<uint8_t position>
-  string white(const string& text) {
-    _private::checkPosition(position);
-    const string white = (position == TEXT)? _private::color_text["white"] : _private::color_background["white"];
-    return white + text + _private::RESET_STYLE;
+  inline bool write_styled(int fd, const Style& style, std::string_view text, ColorDepth depth) {
+    if (depth == ColorDepth::none || style.empty()) return _private::writeAll(fd, text.data(), text.size());
+    const std::string_view code = _private::cachedStyle(style, depth);
+    _private::IoVector parts[3] = {
+      {const_cast<char*>(code.data()), code.size()},
+      {const_cast<char*>(text.data()), text.size()},
+      {const_cast<char*>(_private::RESET_STYLE.data()), _private::RESET_STYLE.size()}
+    };
+    return _private::writeVectors(fd, parts, 3);
   }
 
   /**
-   * @brief Applies the white color to the text.
-   *
-   * This function applies the white color to the text.
-   *
-   * @param text The text to which the white color will be applied.
-   * @return The modified text with the white color applied.
+   * @brief Writes a styled text to a file descriptor with its capability, probed the first time the descriptor is used.
+   * 
+   * A descriptor closed and reused for another output keeps the first capability, pass the depth when that can happen.
+   * 
+   * @param fd The file descriptor to write to.
+   * @param style The style of the text.
+   * @param text The text to write.
+   * 
+   * @return False when the file descriptor reported an error.
   */
-  inline string white(const string& text) {
-    const string white = _private::color_text["white"];
-    return white + text + _private::RESET_STYLE;
+  inline bool write_styled(int fd, const Style& style, std::string_view text) {
+    return write_styled(fd, style, text, _private::cachedFdColorDepth(fd));
   }
 
   /**
-   * @brief Applies the white color to the text.
-   *
-   * This function applies the white color to the text.
-   *
-   * @param os The output stream to which the white color will be applied.
-   * @return The modified output stream with the white color applied.
+   * @brief Collects many styled fragments and sends them to a file descriptor with a single writev call.
+   * 
+   * Between two fragments only the changes of style are added, with one reset at the end of the batch.
+   * The escape codes and the small texts are copied into an internal buffer, the large texts are referenced:
+   * they must stay valid until flush() is called.
+   * 
+   * Example:
+   *   StyledBatch batch(2);
+   *   batch.add(fg(Color::red) | Attribute::bold, "error: ").add(Style(), stack_trace);
+   *   batch.flush();
   */
-  inline ostream& white(ostream& os){
-    os << _private::color_text["white"];
-    return os;
-  }
+  class StyledBatch {
+  public:
+    //Texts from this size are referenced instead of copied.
+    static constexpr std::size_t COPY_LIMIT = 256;
+
+    /**
+     * @param fd The file descriptor to write to, the standard output by default.
+    */
+    explicit StyledBatch(int fd = 1) : fd(fd), depth(_private::fdColorDepth(fd)) {}
+
+    StyledBatch(const StyledBatch&) = delete;
+    StyledBatch& operator=(const StyledBatch&) = delete;
+
+    //Sends what's left in the batch.
+    ~StyledBatch() {
+      flush();
+    }
+
+    /**
+     * @brief Adds a fragment of text with the given style.
+     * 
+     * @param style The style of the text.
+     * @param text The text, referenced until flush() when it's at least COPY_LIMIT long.
+     * 
+     * @return The batch, to chain more calls.
+    */
+    StyledBatch& add(const Style& style, std::string_view text) {
+      if (depth != ColorDepth::none && style != current) {
+        if (style.empty()) addCopy(_private::RESET_STYLE);
+        else if (current.empty()) addCopy(_private::cachedStyle(style, depth));
+        else addCopy(_private::makeStyleDelta(current, style, depth).view());
+        current = style;
+      }
+      if (text.size() < COPY_LIMIT) addCopy(text);
+      else parts.push_back(Part{text.data(), 0, text.size()});
+      return *this;
+    }
+
+    /**
+     * @brief Adds a fragment of text with the style of the previous fragment.
+     * 
+     * @param text The text, referenced until flush() when it's at least COPY_LIMIT long.
+     * 
+     * @return The batch, to chain more calls.
+    */
+    StyledBatch& add(std::string_view text) {
+      return add(current, text);
+    }
+
+    /**
+     * @brief Resets the style and sends every fragment with one writev call, or a few when there are more than IOV_MAX parts.
+     * 
+     * @return False when the file descriptor reported an error.
+    */
+    bool flush() {
+      if (!current.empty()) {
+        addCopy(_private::RESET_STYLE);
+        current = Style();
+      }
+      if (parts.empty()) return true;
+      vectors.clear();
+      for (const Part& part : parts) {
+        const char* data = part.external ? part.external : copies.data() + part.offset;
+        vectors.push_back(_private::IoVector{const_cast<char*>(data), part.length});
+      }
+      const bool written = _private::writeVectors(fd, vectors.data(), vectors.size());
+      parts.clear();
+      copies.clear();
+      return written;
+    }
+
+    //Returns the number of parts waiting to be sent, copied runs count as one.
+    std::size_t pending() const {
+      return parts.size();
+    }
+
+  private:
+    //A run of the internal buffer, stored as an offset since the buffer can move, or a referenced text.
+    struct Part {
+      const char* external;
+      std::size_t offset;
+      std::size_t length;
+    };
+
+    //Copies into the internal buffer, growing the previous part when it's the last copied run.
+    void addCopy(std::string_view text) {
+      if (text.empty()) return;
+      if (!parts.empty() && !parts.back().external && parts.back().offset + parts.back().length == copies.size()) parts.back().length += text.size();
+      else parts.push_back(Part{nullptr, copies.size(), text.size()});
+      copies.append(text);
+    }
+
+    int fd;
+    ColorDepth depth;
+    Style current;
+    string copies;
+    std::vector<Part> parts;
+    std::vector<_private::IoVector> vectors;
+  };
+
+  //Functions for asynchronous output
+
+  //What an AsyncSink does when its queue is full.
+  enum class OverflowPolicy {
+    block, //The producer waits until the writer thread makes room
+    drop   //The record is dropped and counted
+  };
 
   /**
-   * @brief Applies the white color to the background.
-   *
-   * This function applies the white color to the background.
-   *
-   * @param text The text to which the white color will be applied.
-   * @return The modified text with the white color applied.
+   * @brief Writes styled records to a file descriptor from a background thread, so the producers never wait on the output.
+   * 
+   * Producers encode every record (escape code, text and reset style) straight into a slot of a bounded lock-free
+   * multi-producer single-consumer ring. The writer thread gathers the records into large batches, written with one write call each.
+   * When the ring is full the policy chooses between waiting and dropping the record.
+   * 
+   * Example:
+   *   AsyncSink log(2, 4096, OverflowPolicy::drop);
+   *   log.write(Color::red, "disk full\n");
+   *   log.write(fg(Color::yellow) | Attribute::bold, "retrying\n");
   */
-  inline string on_white(const string& text){
-    const string white = _private::color_background["white"];
-    return white + text + _private::RESET_STYLE;
-  }
+  class AsyncSink {
+  public:
+    /**
+     * @param fd The file descriptor to write to, the standard output by default.
+     * @param capacity The number of records the ring holds, rounded up to a power of 2.
+     * @param policy What to do when the ring is full.
+    */
+    explicit AsyncSink(int fd = 1, std::size_t capacity = 1024, OverflowPolicy policy = OverflowPolicy::block)
+      : fd(fd), policy(policy), depth(_private::fdColorDepth(fd)) {
+      std::size_t size = 2;
+      while (size < capacity) size <<= 1;
+      mask = size - 1;
+      cells.reset(new Cell[size]);
+      for (std::size_t index = 0; index < size; index++) cells[index].sequence.store(index, std::memory_order_relaxed);
+      writer = std::thread([this] { run(); });
+    }
+
+    AsyncSink(const AsyncSink&) = delete;
+    AsyncSink& operator=(const AsyncSink&) = delete;
+
+    //Writes every queued record and stops the writer thread.
+    ~AsyncSink() {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping.store(true);
+      }
+      wake.notify_one();
+      writer.join();
+    }
+
+    /**
+     * @brief Queues a text with a style, followed by the reset style. Safe to call from any thread.
+     * 
+     * @param style The style of the text.
+     * @param text The text to write.
+     * 
+     * @return False when the ring was full and the record was dropped.
+    */
+    bool write(const Style& style, std::string_view text) {
+      const std::string_view code = depth == ColorDepth::none ? std::string_view() : _private::cachedStyle(style, depth);
+      const std::string_view reset = code.empty() ? std::string_view() : _private::RESET_STYLE;
+      return push(code, text, reset);
+    }
+
+    /**
+     * @brief Queues a text with one of the standard or bright colors. Safe to call from any thread.
+     * 
+     * @param color The color of the text.
+     * @param text The text to write.
+     * 
+     * @return False when the ring was full and the record was dropped.
+    */
+    bool write(Color color, std::string_view text) {
+      return write(fg(color), text);
+    }
+
+    /**
+     * @brief Queues a text without style. Safe to call from any thread.
+     * 
+     * @param text The text to write.
+     * 
+     * @return False when the ring was full and the record was dropped.
+    */
+    bool write(std::string_view text) {
+      return push(std::string_view(), text, std::string_view());
+    }
+
+    //Waits until every record queued before the call is written to the file descriptor.
+    void flush() {
+      const std::size_t target = enqueue_position.load();
+      std::unique_lock<std::mutex> lock(mutex);
+      flushing.fetch_add(1);
+      drained.wait(lock, [&] { return written_position.load() >= target; });
+      flushing.fetch_sub(1);
+    }
+
+    //Returns how many records were dropped because the ring was full.
+    uint64_t dropped() const {
+      return dropped_records.load(std::memory_order_relaxed);
+    }
+
+    //Returns how many batches the file descriptor failed to write, their records are lost.
+    uint64_t write_errors() const {
+      return failed_writes.load(std::memory_order_relaxed);
+    }
+
+    //Returns how many records are waiting in the ring.
+    std::size_t queue_depth() const {
+      const std::size_t enqueued = enqueue_position.load(std::memory_order_relaxed);
+      const std::size_t dequeued = dequeue_position.load(std::memory_order_relaxed);
+      return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    //Returns the largest number of records seen waiting in the ring by the writer thread.
+    std::size_t max_queue_depth() const {
+      return max_depth.load(std::memory_order_relaxed);
+    }
+
+  private:
+    //Records up to this size are stored inside their slot, longer ones are allocated.
+    static constexpr std::size_t INLINE_SIZE = 192;
+
+    //Size of the batches written by the writer thread.
+    static constexpr std::size_t BATCH_SIZE = 64 * 1024;
+
+    struct alignas(64) Cell {
+      std::atomic<std::size_t> sequence{0}; //Equal to the position when free, to the position + 1 when filled
+      std::size_t length = 0;
+      char data[INLINE_SIZE];
+      string overflow;
+    };
+
+    //Claims a slot with a compare and swap on the enqueue position, then fills it and publishes it.
+    bool push(std::string_view code, std::string_view text, std::string_view reset) {
+      std::size_t position = enqueue_position.load(std::memory_order_relaxed);
+      Cell* cell;
+      for (;;) {
+        cell = &cells[position & mask];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (difference == 0) {
+          if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        }
+        else if (difference < 0) { //full
+          if (policy == OverflowPolicy::drop) {
+            dropped_records.fetch_add(1, std::memory_order_relaxed);
+            return false;
+          }
+          waitForSpace(position);
+          position = enqueue_position.load(std::memory_order_relaxed);
+        }
+        else position = enqueue_position.load(std::memory_order_relaxed);
+      }
+
+      const std::size_t length = code.size() + text.size() + reset.size();
+      cell->length = length;
+      if (length <= INLINE_SIZE) {
+        char* out = cell->data;
+        std::memcpy(out, code.data(), code.size());
+        std::memcpy(out + code.size(), text.data(), text.size());
+        std::memcpy(out + code.size() + text.size(), reset.data(), reset.size());
+      }
+      else {
+        cell->overflow.clear();
+        cell->overflow.append(code).append(text).append(reset);
+      }
+      //Sequentially consistent, like the writer thread announcing its sleep before checking the ring: one of the two sees the other
+      cell->sequence.store(position + 1);
+      if (sleeping.load()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        wake.notify_one();
+      }
+      return true;
+    }
+
+    //Sleeps until the writer thread frees the slot of the position, with the block policy.
+    void waitForSpace(std::size_t position) {
+      std::unique_lock<std::mutex> lock(mutex);
+      blocked.fetch_add(1);
+      space.wait(lock, [&] {
+        //Signed, the position may already be behind the writer thread
+        return static_cast<std::ptrdiff_t>(position - dequeue_position.load()) <= static_cast<std::ptrdiff_t>(mask);
+      });
+      blocked.fetch_sub(1);
+    }
+
+    //Body of the writer thread: moves the records into a batch and writes it when it's full or when the ring is empty.
+    void run() {
+      string batch;
+      batch.reserve(BATCH_SIZE);
+      for (;;) {
+        std::size_t position = dequeue_position.load(std::memory_order_relaxed);
+        Cell& cell = cells[position & mask];
+        if (cell.sequence.load(std::memory_order_acquire) == position + 1) {
+          const std::size_t waiting = enqueue_position.load(std::memory_order_relaxed) - position;
+          if (waiting > max_depth.load(std::memory_order_relaxed)) max_depth.store(waiting, std::memory_order_relaxed);
+          if (cell.length <= INLINE_SIZE) batch.append(cell.data, cell.length);
+          else batch.append(cell.overflow);
+          cell.sequence.store(position + mask + 1, std::memory_order_release);
+          dequeue_position.store(position + 1); //Sequentially consistent, pairs with the blocked producers in writeBatch()
+          if (batch.size() >= BATCH_SIZE) writeBatch(batch, position + 1);
+          continue;
+        }
+
+        writeBatch(batch, position);
+        if (stopping.load(std::memory_order_acquire) && position == enqueue_position.load(std::memory_order_acquire)) return;
+        //The ring is empty: sleep until a producer publishes a record or the sink is destroyed
+        std::unique_lock<std::mutex> lock(mutex);
+        sleeping.store(true);
+        wake.wait(lock, [&] { return cells[position & mask].sequence.load() == position + 1 || stopping.load(); });
+        sleeping.store(false, std::memory_order_relaxed);
+      }
+    }
+
+    //Wakes the blocked producers, then writes the batch and wakes the threads waiting in flush().
+    void writeBatch(string& batch, std::size_t position) {
+      if (blocked.load()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        space.notify_all();
+      }
+      if (!batch.empty()) {
+        if (!_private::writeAll(fd, batch.data(), batch.size())) failed_writes.fetch_add(1, std::memory_order_relaxed);
+        batch.clear();
+      }
+      written_position.store(position);
+      if (flushing.load()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        drained.notify_all();
+      }
+    }
+
+    int fd;
+    OverflowPolicy policy;
+    ColorDepth depth;
+    std::size_t mask = 0;
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<std::size_t> enqueue_position{0};
+    alignas(64) std::atomic<std::size_t> dequeue_position{0};
+    std::atomic<std::size_t> written_position{0};
+    std::atomic<std::size_t> max_depth{0};
+    std::atomic<uint64_t> dropped_records{0};
+    std::atomic<uint64_t> failed_writes{0};
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> sleeping{false};
+    std::atomic<std::size_t> blocked{0};  //Producers waiting for a free slot
+    std::atomic<std::size_t> flushing{0}; //Threads waiting in flush()
+    std::mutex mutex;
+    std::condition_variable wake;    //Wakes the writer thread
+    std::condition_variable space;   //Wakes the blocked producers
+    std::condition_variable drained; //Wakes the threads waiting in flush()
+    std::thread writer; //Last, so the thread starts after every other member is built
+  };
+
+  //Functions for line-atomic output
 
   /**
-   * @brief Applies the white color to the background.
-   *
-   * This function applies the white color to the background.
-   *
-   * @param os The output stream to which the white color will be applied.
-   * @return The modified output stream with the white color applied.
+   * @brief Builds a styled line in a buffer of the calling thread and sends it with a single write when it ends.
+   * 
+   * The line ends with the reset style and a newline, so lines written by different threads never mix their
+   * text or their styles, and a line never leaves the terminal styled. Lines up to PIPE_BUF bytes are sent to a file descriptor
+   * without locking, longer lines, that the system may split, are written while every other line waits.
+   * Lines sent to a stream always take a mutex.
+   * The line is committed by commit() or by the destructor, so a temporary writes its line at the end of the statement.
+   * 
+   * Example:
+   *   StyledLine(2) << fg(Color::red) << "worker " << id << Style() << " failed";
   */
-  inline ostream& on_white(ostream& os){
-    os << _private::color_background["white"];
-    return os;
-  }
+  class StyledLine {
+  public:
+    /**
+     * @param fd The file descriptor to write to, the standard output by default.
+    */
+    explicit StyledLine(int fd = 1) : fd(fd), depth(_private::fdColorDepth(fd)) {
+      start = _private::lineStaging().size();
+    }
 
-  //Functions for bright white color
+    /**
+     * @param os The stream to write to, every line is passed to it with a single write call while holding a mutex,
+     * since streams can't be written by many threads at once.
+    */
+    explicit StyledLine(ostream& os) : os(&os) {
+      {
+        //Reading the flags of the stream can grow its storage, so it's done under the same mutex
+        std::lock_guard<std::mutex> lock(_private::lineGate().mutex);
+        depth = _private::streamColorsEnabled(os) ? _private::streamDepth(os) : ColorDepth::none;
+      }
+      start = _private::lineStaging().size();
+    }
 
-  /**
-   * @brief Applies the bright white color to the text or background based on the position.
-   *
-   * This function applies the bright white color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param os The output stream to which the color will be applied.
-   * @return The modified output stream with the bright white color applied.
-   */
-  template<uint8_t position>
-  ostream& bright_white(ostream& os){
-    _private::checkPosition(position);
-    os << ((position == TEXT)? _private::color_text["bright white"] : _private::color_background["bright white"]);
-    return os;
-  }
+    StyledLine(const StyledLine&) = delete;
+    StyledLine& operator=(const StyledLine&) = delete;
+
+    //Commits the line if something was written since the last commit.
+    ~StyledLine() {
+      if (_private::lineStaging().size() != start || !current.empty()) commit();
+    }
+
+    /**
+     * @brief Changes the style of the following text, appending only the changes from the current style.
+     * 
+     * @param style The style to apply.
+     * 
+     * @return The line, to chain more calls.
+    */
+    StyledLine& apply(const Style& style) {
+      if (depth != ColorDepth::none && style != current) {
+        string& buffer = _private::lineStaging();
+        if (style.empty()) buffer.append(_private::RESET_STYLE);
+        else if (current.empty()) buffer.append(_private::cachedStyle(style, depth));
+        else buffer.append(_private::makeStyleDelta(current, style, depth).view());
+      }
+      current = style;
+      return *this;
+    }
+
+    /**
+     * @brief Appends text with the current style.
+     * 
+     * @param text The text to append.
+     * 
+     * @return The line, to chain more calls.
+    */
+    StyledLine& write(std::string_view text) {
+      _private::lineStaging().append(text);
+      return *this;
+    }
+
+    /**
+     * @brief Appends text with the given style, that stays applied to the following text.
+     * 
+     * @param style The style of the text.
+     * @param text The text to append.
+     * 
+     * @return The line, to chain more calls.
+    */
+    StyledLine& write(const Style& style, std::string_view text) {
+      apply(style);
+      return write(text);
+    }
+
+    StyledLine& operator<<(std::string_view text) {
+      return write(text);
+    }
+
+    StyledLine& operator<<(char character) {
+      return write(std::string_view(&character, 1));
+    }
+
+    StyledLine& operator<<(const Style& style) {
+      return apply(style);
+    }
+
+    //Appends the decimal text of an integer, formatted without allocating.
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>>>
+    StyledLine& operator<<(T number) {
+      char digits[24];
+      const auto result = std::to_chars(digits, digits + sizeof(digits), number);
+      return write(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+    }
+
+    /**
+     * @brief Ends the line with the reset style and a newline, and sends it. The object can then build another line.
+     * 
+     * @return False when the output reported an error.
+    */
+    bool commit() {
+      apply(Style());
+      string& buffer = _private::lineStaging();
+      buffer.push_back('\n');
+      const char* data = buffer.data() + start;
+      const std::size_t size = buffer.size() - start;
+      _private::LineGate& gate = _private::lineGate();
+      if (os) {
+        std::lock_guard<std::mutex> lock(gate.mutex);
+        const bool written = send(data, size);
+        buffer.resize(start);
+        return written;
+      }
+      const bool written = gate.write(size, [&] { return send(data, size); });
+      buffer.resize(start);
+      return written;
+    }
 
-  /**
-   * @brief Applies the bright white color to the text based on the position.
-   *
-   * This function applies the bright white color to the specified position (either text or background),
-   * depending on the value of the position parameter.
-   *
-   * @tparam position Either TEXT (1) or BACKGROUND (0), indicating where the color should be applied.
-   * @param text The text to which the bright white color will be applied.
-   * @return The modified text with the bright white color applied.
-   */
-  template<uint8_t position>
-  string bright_white(const string& text) {
-    _private::checkPosition(position);
-    const string bright_white = (position == TEXT)? _private::color_text["bright white"] : _private::color_background["bright white"];
-    return bright_white + text + _private::RESET_STYLE;
-  }
+  private:
+    bool send(const char* data, std::size_t size) {
+      if (!os) return _private::writeAll(fd, data, size);
+      os->write(data, static_cast<std::streamsize>(size));
+      return !os->fail();
+    }
 
-  /**
-   * @brief Applies the bright white color to the text.
-   *
-   * This function applies the bright white color to the text.
-   *
-   * @param text The text to which the bright white color will be applied.
-   * @return The modified text with the bright white color applied.
-   */
-  inline string bright_white(const string& text) {
-    const string bright_white = _private::color_text["bright white"];
-    return bright_white + text + _private::RESET_STYLE;
-  }
+    ostream* os = nullptr;
+    int fd = -1;
+    ColorDepth depth;
+    Style current;
+    std::size_t start; //Where this line begins in the staging buffer, lines built at the same time on one thread stack up
+  };
 
-  /**
-   * @brief Applies the bright white color to the text.
-   *
-   * This function applies the bright white color to the text.
-   *
-   * @param os The output stream to which the bright white color will be applied.
-   * @return The modified output stream with the bright white color applied.
-   */
-  inline ostream& bright_white(ostream& os){
-    os << _private::color_text["bright white"];
-    return os;
-  }
+  //Functions for escape stripping
 
   /**
-   * @brief Applies the bright white color to the background.
-   *
-   * This function applies the bright white color to the background.
-   *
-   * @param text The text to which the bright white color will be applied.
-   * @return The modified text with the bright white color applied.
-   */
-  inline string on_bright_white(const string& text){
-    const string bright_white = _private::color_background["bright white"];
-    return bright_white + text + _private::RESET_STYLE;
+   * @brief Removes every ANSI escape sequence from the text, leaving the plain text.
+   * 
+   * The text between the escape sequences is copied in bulk, so text with few escapes is copied at memcpy speed.
+   * 
+   * @param text The styled text.
+   * 
+   * @return The text without the escape sequences.
+  */
+  inline string strip(std::string_view text) {
+    string result;
+    result.reserve(text.size());
+    const char* position = text.data();
+    const char* const end = position + text.size();
+    while (position != end) {
+      const char* escape = _private::findEscape(position, end);
+      result.append(position, static_cast<std::size_t>(escape - position));
+      if (escape == end) break;
+      position = escape + _private::escapeLength(escape, end);
+    }
+    return result;
   }
 
   /**
-   * @brief Applies the bright white color to the background.
-   *
-   * This function applies the bright white color to the background.
-   *
-   * @param os The output stream to which the bright white color will be applied.
-   * @return The modified output stream with the bright white color applied.
-   */
-  inline ostream& on_bright_white(ostream& os){
-    os << _private::color_background["bright white"];
-    return os;
+   * @brief Removes every ANSI escape sequence from the text, without allocating.
+   * 
+   * @param text The styled text, replaced by the plain text.
+  */
+  inline void strip_in_place(string& text) {
+    char* const data = text.data();
+    const char* position = data;
+    const char* const end = data + text.size();
+    char* output = data;
+    while (position != end) {
+      const char* escape = _private::findEscape(position, end);
+      const std::size_t run = static_cast<std::size_t>(escape - position);
+      if (output != position) std::memmove(output, position, run);
+      output += run;
+      if (escape == end) break;
+      position = escape + _private::escapeLength(escape, end);
+    }
+    text.resize(static_cast<std::size_t>(output - data));
   }
 
-  //Functions for bold style
+  //Functions for measuring styled text
 
   /**
-   * @brief Applies bold style to the stream.
-   * 
-   * @param os The stream to apply the bold style to.
+   * @brief Returns how many terminal columns the text takes once printed.
    * 
-   * @return The modified stream.
-  */
-  inline ostream& bold(ostream& os){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    return os << "\033[1m";
-  }
-  
-  /**
-   * @brief Applies bold style to the text.
+   * The escape sequences take no space, the UTF-8 characters are measured with the Unicode East Asian Width
+   * and the zero width characters take no space. Runs of printable ASCII are counted 16 bytes at a time with SSE2.
    * 
-   * @param text The text to apply the bold style to.
+   * @param text The styled text.
    * 
-   * @return The modified text with bold style applied.
+   * @return The visible width of the text.
   */
-  inline string bold(const string& text) {
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    const string bold = "\033[1m";
-    return bold + text + _private::RESET_STYLE;
+  inline std::size_t visible_width(std::string_view text) {
+    std::size_t width = 0;
+    const char* position = text.data();
+    const char* const end = position + text.size();
+    while (position != end) {
+      #ifdef CLISTYLE_SSE2
+      if (end - position >= 16) {
+        const unsigned printable = _private::countPrintable(position);
+        width += printable;
+        position += printable;
+        if (printable == 16) continue;
+      }
+      #endif
+      const unsigned char byte = static_cast<unsigned char>(*position);
+      if (byte == static_cast<unsigned char>(_private::ESCAPE)) {
+        position += _private::escapeLength(position, end);
+      }
+      else if (byte < 0x80) {
+        width += (byte >= 0x20 && byte != 0x7F) ? 1 : 0;
+        position++;
+      }
+      else {
+        width += _private::codepointWidth(_private::decodeUtf8(position, end));
+      }
+    }
+    return width;
   }
 
-  //Functions for italic style
+  //Functions for table rendering
 
   /**
-   * @brief Applies italic style to the stream.
+   * @brief Writes styled cells as aligned columns, streaming the rows instead of buffering the whole table.
    * 
-   * @param os The stream to apply the italic style to.
+   * The column widths are estimated from the first rows, measured with visible_width() so the escape
+   * sequences don't count. Once the sample is full it's written out, and every following row is written as soon as it's added.
+   * A later cell wider than its column widens it for the rows after it.
    * 
-   * @return The modified stream.
+   * With a maximum column width the table is bounded: every cell is cut to that width, keeping its escape
+   * sequences whole and resetting the style after a cut, so no column grows past it however many rows there are.
+   * 
+   * Example:
+   *   TableRenderer table(cout);
+   *   table.row({red("error"), "disk full"});
+   *   table.finish();
   */
-  inline ostream& italic(ostream& os){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    return os << "\033[3m";
-  }
+  class TableRenderer {
+  public:
+    /**
+     * @param os The stream to write the table to.
+     * @param sample_rows How many rows to read before estimating the column widths.
+     * @param max_column_width The maximum width of a column, 0 to never cut a cell.
+     * @param separator The text written between two columns.
+    */
+    explicit TableRenderer(ostream& os, std::size_t sample_rows = 64, std::size_t max_column_width = 0, std::string_view separator = " ")
+      : os(os), sample_rows(sample_rows == 0 ? 1 : sample_rows), max_column_width(max_column_width), separator(separator) {}
+
+    TableRenderer(const TableRenderer&) = delete;
+    TableRenderer& operator=(const TableRenderer&) = delete;
+
+    //Writes the rows still in the sample.
+    ~TableRenderer() {
+      finish();
+    }
+
+    /**
+     * @brief Adds a row of cells, written now or once the sample is full.
+     * 
+     * @param cells The styled text of every cell.
+     * 
+     * @return The renderer, to chain more calls.
+    */
+    TableRenderer& row(std::initializer_list<std::string_view> cells) {
+      return row(cells.begin(), cells.size());
+    }
+
+    /**
+     * @brief Adds a row of cells, written now or once the sample is full.
+     * 
+     * @param cells The styled text of every cell.
+     * 
+     * @return The renderer, to chain more calls.
+    */
+    TableRenderer& row(const std::vector<string>& cells) {
+      std::vector<std::string_view> views(cells.begin(), cells.end());
+      return row(views.data(), views.size());
+    }
+
+    /**
+     * @brief Adds a row of cells, written now or once the sample is full.
+     * 
+     * @param cells The styled text of every cell.
+     * @param count The number of cells.
+     * 
+     * @return The renderer, to chain more calls.
+    */
+    TableRenderer& row(const std::string_view* cells, std::size_t count) {
+      if (streaming) {
+        writeRow(cells, count);
+        return *this;
+      }
+      if (widths.size() < count) widths.resize(count, 0);
+      sample_starts.push_back(sample_cells.size());
+      for (std::size_t index = 0; index < count; index++) {
+        std::size_t width;
+        if (max_column_width != 0) { //only the part that will be shown is kept
+          line.clear();
+          width = _private::appendTruncated(line, cells[index], max_column_width);
+          sample_cells.push_back(line);
+        }
+        else {
+          width = visible_width(cells[index]);
+          sample_cells.emplace_back(cells[index]);
+        }
+        if (width > widths[index]) widths[index] = width;
+      }
+      if (sample_starts.size() == sample_rows) flushSample();
+      return *this;
+    }
+
+    /**
+     * @brief Writes the rows still in the sample, the following rows are written as soon as they're added.
+    */
+    void finish() {
+      if (!streaming) flushSample();
+      os.flush();
+    }
+
+    //Returns the current width of every column.
+    const std::vector<std::size_t>& column_widths() const {
+      return widths;
+    }
+
+  private:
+    //Writes the sample with the estimated widths and frees it.
+    void flushSample() {
+      streaming = true;
+      std::vector<std::string_view> views;
+      for (std::size_t index = 0; index < sample_starts.size(); index++) {
+        const std::size_t first = sample_starts[index];
+        const std::size_t last = index + 1 < sample_starts.size() ? sample_starts[index + 1] : sample_cells.size();
+        views.assign(sample_cells.begin() + static_cast<std::ptrdiff_t>(first), sample_cells.begin() + static_cast<std::ptrdiff_t>(last));
+        writeRow(views.data(), views.size());
+      }
+      std::vector<string>().swap(sample_cells);
+      std::vector<std::size_t>().swap(sample_starts);
+    }
+
+    //Builds the whole line in a reused buffer and writes it at once.
+    void writeRow(const std::string_view* cells, std::size_t count) {
+      if (widths.size() < count) widths.resize(count, 0);
+      line.clear();
+      for (std::size_t index = 0; index < count; index++) {
+        if (index != 0) line.append(separator);
+        std::size_t width;
+        if (max_column_width != 0) width = _private::appendTruncated(line, cells[index], max_column_width);
+        else {
+          width = visible_width(cells[index]);
+          line.append(cells[index]);
+        }
+        if (width > widths[index]) widths[index] = width; //a cell wider than the sample widens the column for the following rows
+        if (index + 1 < count) line.append(widths[index] - (width < widths[index] ? width : widths[index]), ' ');
+      }
+      line.push_back('\n');
+      os.write(line.data(), static_cast<std::streamsize>(line.size()));
+    }
+
+    ostream& os;
+    std::size_t sample_rows;
+    std::size_t max_column_width;
+    string separator;
+    bool streaming = false;
+    std::vector<std::size_t> widths;
+    std::vector<string> sample_cells; //The cells of the sampled rows, one after another
+    std::vector<std::size_t> sample_starts; //The index of the first cell of every sampled row
+    string line;
+  };
+
+  //Functions for progress bars
 
   /**
-   * @brief Applies italic style to the text.
+   * @brief Progress bar drawn with a color gradient, that can be updated from many threads at once.
    * 
-   * @param text The text to apply the italic style to.
+   * update() is a single atomic addition, the drawing happens in tick(): either from the thread started by start(),
+   * at a fixed number of frames per second, or from a loop of the caller. A frame is written only when the visible
+   * text changed, with a single write to the file descriptor. When the output isn't a terminal only the last frame is written.
    * 
-   * @return The modified text with italic style applied.
+   * Example:
+   *   ProgressBar bar(files.size(), "copying");
+   *   bar.start();
+   *   for (const auto& file : files) { copy(file); bar.update(); }
+   *   bar.finish();
   */
-  inline string italic(const string& text) {
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    const string italic = "\033[3m";
-    return italic + text + _private::RESET_STYLE;
-  }
+  class ProgressBar {
+  public:
+    /**
+     * @param total The value that fills the bar.
+     * @param label The text written before the bar.
+     * @param fd The file descriptor to draw to, the standard error by default.
+    */
+    explicit ProgressBar(uint64_t total, std::string_view label = "", int fd = 2)
+      : total(total), label(label), fd(fd), interactive(_private::isTerminal(fd)) {
+      painter.depth = _private::fdColorDepth(fd);
+    }
 
-  //Functions for underline style
+    ProgressBar(const ProgressBar&) = delete;
+    ProgressBar& operator=(const ProgressBar&) = delete;
+
+    //Stops the drawing thread and draws the last frame.
+    ~ProgressBar() {
+      finish();
+    }
+
+    //Sets how many cells the bar takes, before the drawing starts.
+    ProgressBar& width(std::size_t cells) {
+      painter.width = cells == 0 ? 1 : cells;
+      painter.codes.clear();
+      return *this;
+    }
+
+    //Sets the colors of the first and of the last cell of the bar, before the drawing starts.
+    ProgressBar& gradient(Rgb from, Rgb to) {
+      painter.from = from;
+      painter.to = to;
+      painter.codes.clear();
+      return *this;
+    }
+
+    //Sets how many frames per second the thread started by start() draws, before it's started.
+    ProgressBar& fps(unsigned frames) {
+      frame_interval = std::chrono::microseconds(1000000 / (frames == 0 ? 1 : frames));
+      return *this;
+    }
+
+    //Adds to the progress, safe to call from any thread.
+    void update(uint64_t amount = 1) {
+      current.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    //Replaces the progress, safe to call from any thread.
+    void set(uint64_t value) {
+      current.store(value, std::memory_order_relaxed);
+    }
+
+    //Returns the progress.
+    uint64_t value() const {
+      return current.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Draws the bar if its text changed since the last frame.
+     * 
+     * Only one thread should draw: either call it from a single thread or use start().
+     * 
+     * @return True when a frame was written.
+    */
+    bool tick() {
+      if (!interactive && !finished) return false;
+      frame.assign(interactive ? "\r" : "");
+      if (!label.empty()) {
+        frame.append(label);
+        frame.push_back(' ');
+      }
+      painter.append(frame, value(), total);
+      if (frame == last_frame) return false;
+      last_frame.swap(frame);
+      _private::writeAll(fd, last_frame.data(), last_frame.size());
+      return true;
+    }
+
+    //Starts a thread that calls tick() at the chosen frame rate, until finish() is called.
+    void start() {
+      renderer.start(frame_interval, [this] { tick(); });
+    }
+
+    //Stops the drawing thread, draws the last frame and ends the line, only the first time it's called.
+    void finish() {
+      if (finished) return;
+      renderer.stop();
+      finished = true;
+      tick();
+      _private::writeAll(fd, "\n", 1);
+    }
+
+  private:
+    std::atomic<uint64_t> current{0};
+    uint64_t total;
+    string label;
+    int fd;
+    bool interactive; //False when the output isn't a terminal, then only the last frame is written
+    _private::BarPainter painter;
+    std::chrono::microseconds frame_interval{1000000 / 15};
+    string frame;
+    string last_frame;
+    bool finished = false;
+    _private::FrameThread renderer; //Last, so the thread is stopped before the members it uses are destroyed
+  };
 
   /**
-   * @brief Applies underline style to the stream.
+   * @brief Region of progress bars, one line per bar plus an optional total, fed by many threads at once.
    * 
-   * @param os The stream to apply the underline style to.
+   * Every bar has its own atomic counter on its own cache line, so the workers never contend.
+   * A single thread draws: it redraws only the lines whose value changed since the last frame, moving the cursor
+   * up to them and back, and writes the whole frame at once. When the output isn't a terminal only the last frame is written.
    * 
-   * @return The modified stream.
+   * Example:
+   *   MultiProgress progress(workers);
+   *   for (std::size_t worker = 0; worker < workers; worker++) progress.configure(worker, "worker " + to_string(worker), jobs);
+   *   progress.start();
+   *   ... progress.update(worker); ...
+   *   progress.finish();
   */
-  inline ostream& underline(ostream& os){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    return os << "\033[4m";
-  }
+  class MultiProgress {
+  public:
+    /**
+     * @param bars The number of bars.
+     * @param fd The file descriptor to draw to, the standard error by default.
+     * @param show_total Adds a last line with the sum of every bar.
+    */
+    explicit MultiProgress(std::size_t bars, int fd = 2, bool show_total = true)
+      : bars(bars), slots(new Slot[bars]), labels(bars), totals(bars, 0), drawn(bars + 1, NOT_DRAWN),
+        fd(fd), show_total(show_total), interactive(_private::isTerminal(fd)) {
+      painter.depth = _private::fdColorDepth(fd);
+    }
+
+    MultiProgress(const MultiProgress&) = delete;
+    MultiProgress& operator=(const MultiProgress&) = delete;
+
+    //Stops the drawing thread and draws the last frame.
+    ~MultiProgress() {
+      finish();
+    }
+
+    //Sets the label and the total of a bar, before the drawing starts.
+    MultiProgress& configure(std::size_t bar, std::string_view label, uint64_t total) {
+      checkBar(bar);
+      labels[bar] = string(label);
+      totals[bar] = total;
+      label_width = 0;
+      return *this;
+    }
+
+    //Sets how many cells every bar takes, before the drawing starts.
+    MultiProgress& width(std::size_t cells) {
+      painter.width = cells == 0 ? 1 : cells;
+      painter.codes.clear();
+      return *this;
+    }
+
+    //Sets the colors of the first and of the last cell of the bars, before the drawing starts.
+    MultiProgress& gradient(Rgb from, Rgb to) {
+      painter.from = from;
+      painter.to = to;
+      painter.codes.clear();
+      return *this;
+    }
+
+    //Sets how many frames per second the thread started by start() draws, before it's started.
+    MultiProgress& fps(unsigned frames) {
+      frame_interval = std::chrono::microseconds(1000000 / (frames == 0 ? 1 : frames));
+      return *this;
+    }
+
+    //Adds to the progress of a bar, safe to call from any thread.
+    void update(std::size_t bar, uint64_t amount = 1) {
+      slots[bar].value.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    //Replaces the progress of a bar, safe to call from any thread.
+    void set(std::size_t bar, uint64_t value) {
+      slots[bar].value.store(value, std::memory_order_relaxed);
+    }
+
+    //Returns the progress of a bar.
+    uint64_t value(std::size_t bar) const {
+      return slots[bar].value.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Redraws the lines that changed since the last frame.
+     * 
+     * Only one thread should draw: either call it from a single thread or use start().
+     * 
+     * @return True when a frame was written.
+    */
+    bool tick() {
+      if (!interactive && !finished) return false;
+      return draw();
+    }
+
+    //Starts a thread that calls tick() at the chosen frame rate, until finish() is called.
+    void start() {
+      renderer.start(frame_interval, [this] { tick(); });
+    }
+
+    //Stops the drawing thread and draws the last frame, only the first time it's called.
+    void finish() {
+      if (finished) return;
+      renderer.stop();
+      finished = true;
+      draw();
+    }
+
+  private:
+    struct alignas(64) Slot {
+      std::atomic<uint64_t> value{0};
+    };
+
+    static constexpr uint64_t NOT_DRAWN = ~uint64_t(0);
+
+    bool draw() {
+      if (label_width == 0) {
+        for (const string& label : labels) label_width = std::max(label_width, visible_width(label));
+        label_width = std::max<std::size_t>(label_width, show_total ? 5 : 1); //at least "total"
+      }
+      const std::size_t lines = bars + (show_total ? 1 : 0);
+      const bool first = rows_drawn == 0;
+      frame.clear();
+      std::size_t row = first ? 0 : lines; //The cursor stays on the line after the region between two frames
+      uint64_t sum = 0;
+      uint64_t sum_total = 0;
+      for (std::size_t line = 0; line < lines; line++) {
+        uint64_t progress;
+        uint64_t total;
+        std::string_view label;
+        if (line < bars) {
+          progress = std::min(value(line), totals[line]);
+          total = totals[line];
+          label = labels[line];
+          sum += progress;
+          sum_total += total;
+        }
+        else {
+          progress = sum;
+          total = sum_total;
+          label = "total";
+        }
+        if (progress == drawn[line]) continue;
+        drawn[line] = progress;
+
+        if (!first) moveCursor(row, line);
+        frame.push_back('\r');
+        frame.append(label);
+        frame.append(label_width - visible_width(label) + 1, ' ');
+        painter.append(frame, progress, total);
+        frame.append(first ? "\n" : "\033[K");
+        row = first ? line + 1 : line;
+      }
+      if (frame.empty()) return false;
+      moveCursor(row, lines);
+      frame.push_back('\r');
+      rows_drawn = lines;
+      _private::writeAll(fd, frame.data(), frame.size());
+      return true;
+    }
+
+    //Appends the escape code that moves the cursor from one line of the region to another.
+    void moveCursor(std::size_t from, std::size_t to) {
+      if (from == to) return;
+      frame.append("\033[");
+      frame.append(to_string(from > to ? from - to : to - from));
+      frame.push_back(from > to ? 'A' : 'B');
+    }
+
+    void checkBar(std::size_t bar) const {
+      if (bar >= bars) {
+        std::cerr << "Bar must be less than " << bars;
+        exit(EXIT_FAILURE);
+      }
+    }
+
+    std::size_t bars;
+    std::unique_ptr<Slot[]> slots;
+    std::vector<string> labels;
+    std::vector<uint64_t> totals;
+    std::vector<uint64_t> drawn; //The value of every line in the last frame
+    int fd;
+    bool show_total;
+    bool interactive;
+    _private::BarPainter painter;
+    std::chrono::microseconds frame_interval{1000000 / 15};
+    std::size_t label_width = 0;
+    std::size_t rows_drawn = 0;
+    string frame;
+    bool finished = false;
+    _private::FrameThread renderer; //Last, so the thread is stopped before the members it uses are destroyed
+  };
+
+  //Functions for parsing styled text
+
+  //A run of text and the style applied to it.
+  struct Span {
+    std::string_view text;
+    Style style;
+  };
 
   /**
-   * @brief Applies underline style to the text.
+   * @brief Incremental parser that splits styled text back into spans of plain text and their Style.
    * 
-   * @param text The text to apply the underline style to.
+   * The input can be fed in chunks of any size, an escape sequence split between two chunks is handled.
+   * The spans point into the fed chunks, so the text is never copied: a span is valid as long as its chunk is.
+   * Every escape sequence that isn't SGR is skipped.
    * 
-   * @return The modified text with underline style applied.
+   * Example:
+   *   SgrTokenizer tokenizer;
+   *   tokenizer.feed(red("error"), [](const Span& span) { ... });
   */
-  inline string underline(const string& text) { 
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    const string underline = "\033[4m";
-    return underline + text + _private::RESET_STYLE;
-  }
+  class SgrTokenizer {
+  public:
+    /**
+     * @brief Parses a chunk of bytes, calling the callback for every span of text found in it.
+     * 
+     * @param chunk The bytes to parse.
+     * @param on_span Called with a const Span& for every non-empty run of text.
+    */
+    template <typename Callback>
+    void feed(std::string_view chunk, Callback&& on_span) {
+      const char* position = chunk.data();
+      const char* const end = position + chunk.size();
+      while (position != end) {
+        if (state == State::text) {
+          const char* escape = _private::findEscape(position, end);
+          if (escape != position) on_span(Span{std::string_view(position, static_cast<std::size_t>(escape - position)), current});
+          if (escape == end) return;
+          state = State::escape;
+          position = escape + 1;
+          continue;
+        }
+        if (consume(*position)) position++;
+      }
+    }
 
-  //Functions for reverse style
+    //Returns the style applied to the text that follows.
+    const Style& style() const {
+      return current;
+    }
+
+    //Goes back to the default style and drops any partial escape sequence.
+    void reset() {
+      *this = SgrTokenizer();
+    }
+
+  private:
+    enum class State : uint8_t { text, escape, intermediate, csi, string, string_escape };
+
+    static constexpr std::size_t PARAMETERS_SIZE = 128;
+
+    //Advances the escape sequence state machine by one byte, returns false when the byte belongs to the text instead.
+    bool consume(char character) {
+      const unsigned char byte = static_cast<unsigned char>(character);
+      switch (state) {
+        case State::escape:
+          if (byte == '[') {
+            state = State::csi;
+            parameters_length = 0;
+            overflow = false;
+          }
+          else if (byte == ']' || byte == 'P' || byte == 'X' || byte == '^' || byte == '_') state = State::string;
+          else if (byte >= 0x20 && byte <= 0x2F) state = State::intermediate;
+          else state = State::text;
+          break;
+        case State::intermediate:
+          if (byte < 0x20 || byte > 0x2F) state = State::text;
+          break;
+        case State::csi:
+          if (byte >= 0x40 && byte <= 0x7E) {
+            if (byte == 'm' && !overflow) _private::applySgr(current, std::string_view(parameters, parameters_length));
+            state = State::text;
+          }
+          else if (byte >= 0x20 && byte <= 0x3F) {
+            if (parameters_length < PARAMETERS_SIZE) parameters[parameters_length++] = character;
+            else overflow = true;
+          }
+          else {
+            state = State::text; //malformed, the sequence ends before this byte like in strip()
+            return false;
+          }
+          break;
+        case State::string:
+          if (byte == '\a') state = State::text;
+          else if (character == _private::ESCAPE) state = State::string_escape;
+          break;
+        case State::string_escape:
+          state = byte == '\\' ? State::text : State::string;
+          break;
+        case State::text:
+          break;
+      }
+      return true;
+    }
+
+    Style current;
+    State state = State::text;
+    bool overflow = false;
+    std::size_t parameters_length = 0;
+    char parameters[PARAMETERS_SIZE] = {};
+  };
+
+  //Functions for lazy styling
 
   /**
-   * @brief Applies reverse style to the stream.
+   * @brief Proxy that writes a value between a style and the reset style when it's inserted in a stream.
    * 
-   * @param os The stream to apply the reverse style to.
+   * The proxy only keeps a reference to the value, so it should be used in the same expression that creates it.
    * 
-   * @return The modified stream.
+   * @tparam T The type of the value, anything that can be written to a stream with operator<<.
   */
-  inline ostream& reverse(ostream& os){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    return os << "\033[7m";
-  }
+  template <typename T>
+  struct Styled {
+    ostream& (*manipulator)(ostream&);
+    Style style; //Used when there is no manipulator
+    const T& value;
+  };
 
   /**
-   * @brief Applies reverse style to the text.
+   * @brief Styles a value without building an intermediate string.
    * 
-   * @param text The text to apply the reverse style to.
+   * Example: cout << CLIStyle::styled(CLIStyle::red, 42) << endl;
    * 
-   * @return The modified text with reverse style applied.
+   * @tparam T The type of the value, anything that can be written to a stream with operator<<.
+   * 
+   * @param manipulator The stream function that applies the style, like red or on_blue.
+   * @param value The value to style.
+   * 
+   * @return The proxy that writes the styled value when it's inserted in a stream.
   */
-  inline string reverse(const string& text) { 
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    const string reverse = "\033[7m";
-    return reverse + text + _private::RESET_STYLE;
+  template <typename T>
+  Styled<T> styled(ostream& (*manipulator)(ostream&), const T& value) {
+    return Styled<T>{manipulator, Style(), value};
   }
 
-  //Functions for reset style
-
   /**
-   * @brief Resets the stream to the default style.
+   * @brief Styles a value with a combined style without building an intermediate string.
    * 
-   * @param os The stream to reset.
-   * @return The modified stream with the default style.
+   * Example: cout << CLIStyle::styled(Attribute::bold | fg(Color::red), 42) << endl;
+   * 
+   * @tparam T The type of the value, anything that can be written to a stream with operator<<.
+   * 
+   * @param style The style to apply.
+   * @param value The value to style.
+   * 
+   * @return The proxy that writes the styled value when it's inserted in a stream.
   */
-  inline ostream& reset(ostream& os){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    os << _private::RESET_STYLE;
-    return os;
+  template <typename T>
+  Styled<T> styled(const Style& style, const T& value) {
+    return Styled<T>{nullptr, style, value};
   }
 
   /**
-   * @brief Resets the text to the default style.
+   * @brief Writes the style, the value and the reset style directly into the stream.
    * 
-   * @param text The text to reset.
-   * @return The modified text with the default style.
+   * @param os The stream to write to.
+   * @param styled The proxy returned by styled().
+   * 
+   * @return The modified stream.
   */
-  inline string reset(const string& text){
-    if (!_private::handleVTSequences) _private::enableVTSequences(_private::handleVTSequences);
-    return text + _private::RESET_STYLE;
+  template <typename T>
+  ostream& operator<<(ostream& os, const Styled<T>& styled) {
+    if (styled.manipulator) styled.manipulator(os);
+    else os << styled.style;
+    os << styled.value;
+    return reset(os);
   }
 }
 
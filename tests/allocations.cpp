@@ -0,0 +1,112 @@
+/*
+Checks that the string overloads allocate at most once per call, and that the rvalue overloads don't allocate
+when the buffer they're given is already large enough.
+
+Build and run from the repository root:
+  g++ -std=c++17 -O2 -I. tests/allocations.cpp -o allocations && ./allocations
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+//Forces the colors before the header detects the terminal, this object is initialized first since it's defined first.
+static const bool colors_forced = [] {
+  #ifdef _WIN32
+  _putenv_s("FORCE_COLOR", "3");
+  #else
+  setenv("FORCE_COLOR", "3", 1);
+  #endif
+  return true;
+}();
+
+#include "clistyle.hpp"
+
+static std::size_t allocations = 0;
+static bool counting = false;
+
+void* operator new(std::size_t size) {
+  if (counting) allocations++;
+  if (void* memory = std::malloc(size == 0 ? 1 : size)) return memory;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+static int failures = 0;
+
+static void report(const char* name, std::size_t limit) {
+  if (allocations > limit) {
+    std::printf("FAIL %s: %zu allocations, expected at most %zu\n", name, allocations, limit);
+    failures++;
+  }
+  else std::printf("ok   %s: %zu allocations\n", name, allocations);
+}
+
+//Counts the allocations of an overload taking a const string&, the result is destroyed outside the count.
+template <typename Function>
+void expectCopy(const char* name, std::size_t limit, const string& text, Function function) {
+  allocations = 0;
+  counting = true;
+  const string result = function(text);
+  counting = false;
+  report(name, limit);
+}
+
+//Counts the allocations of an overload taking a string&&, the text is built outside the count.
+template <typename Function>
+void expectMove(const char* name, std::size_t limit, string text, Function function) {
+  allocations = 0;
+  counting = true;
+  const string result = function(std::move(text));
+  counting = false;
+  report(name, limit);
+}
+
+int main() {
+  using namespace CLIStyle;
+  const string text = "a log field long enough to be on the heap";
+  const string short_text = "ok";
+  if (red(text) == text) {
+    std::printf("FAIL the colors couldn't be forced\n");
+    return EXIT_FAILURE;
+  }
+
+  expectCopy("red(const string&)", 1, text, [](const string& value) { return red(value); });
+  expectCopy("red(const string&), short text", 1, short_text, [](const string& value) { return red(value); });
+  expectCopy("on_red(const string&)", 1, text, [](const string& value) { return on_red(value); });
+  expectCopy("bold(const string&)", 1, text, [](const string& value) { return bold(value); });
+  expectCopy("italic(const string&)", 1, text, [](const string& value) { return italic(value); });
+  expectCopy("grey(const string&)", 1, text, [](const string& value) { return grey(value); });
+  expectCopy("color<TEXT, r, g, b>(const string&)", 1, text, [](const string& value) { return color<TEXT, 255, 128, 0>(value); });
+  expectCopy("color<r, g, b>(const string&)", 1, text, [](const string& value) { return color<12, 34, 56>(value); });
+  expectCopy("color256<BACKGROUND, i>(const string&)", 1, text, [](const string& value) { return color256<BACKGROUND, 202>(value); });
+
+  //A buffer of the exact size grows once
+  expectMove("red(string&&)", 1, text, [](string&& value) { return red(std::move(value)); });
+  expectMove("on_red(string&&)", 1, text, [](string&& value) { return on_red(std::move(value)); });
+  expectMove("bold(string&&)", 1, text, [](string&& value) { return bold(std::move(value)); });
+  expectMove("color<TEXT, r, g, b>(string&&)", 1, text, [](string&& value) { return color<TEXT, 255, 128, 0>(std::move(value)); });
+  expectMove("color256<TEXT, i>(string&&)", 1, text, [](string&& value) { return color256<TEXT, 202>(std::move(value)); });
+
+  //A buffer with room for the escape codes is reused as it is
+  const auto roomy = [&] {
+    string buffer;
+    buffer.reserve(text.size() + 64);
+    buffer.append(text);
+    return buffer;
+  };
+  expectMove("red(string&&), buffer with room", 0, roomy(), [](string&& value) { return red(std::move(value)); });
+  expectMove("on_red(string&&), buffer with room", 0, roomy(), [](string&& value) { return on_red(std::move(value)); });
+  expectMove("bold(string&&), buffer with room", 0, roomy(), [](string&& value) { return bold(std::move(value)); });
+  expectMove("color<r, g, b>(string&&), buffer with room", 0, roomy(), [](string&& value) { return color<12, 34, 56>(std::move(value)); });
+  expectMove("color256<TEXT, i>(string&&), buffer with room", 0, roomy(), [](string&& value) { return color256<TEXT, 202>(std::move(value)); });
+
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
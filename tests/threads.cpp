@@ -0,0 +1,91 @@
+/*
+Stress test for the shared state of the library: the terminal capability that init() publishes,
+the per-thread escape code caches and the descriptor capability cache, used by many threads at once.
+
+Build and run from the repository root, under ThreadSanitizer:
+  g++ -std=c++17 -O1 -g -fsanitize=thread -pthread -I. tests/threads.cpp -o threads && ./threads
+*/
+
+#include <cstdio>
+#include <cstdlib>
+
+//Forces the colors before the header detects the terminal, this object is initialized first since it's defined first.
+static const bool colors_forced = [] {
+  #ifdef _WIN32
+  _putenv_s("FORCE_COLOR", "3");
+  #else
+  setenv("FORCE_COLOR", "3", 1);
+  #endif
+  return true;
+}();
+
+#include "clistyle.hpp"
+
+#include <fcntl.h>
+#include <sstream>
+
+using namespace CLIStyle;
+
+constexpr int THREADS = 8;
+constexpr int ITERATIONS = 20000;
+
+int main() {
+  #ifdef _WIN32
+  const int sink = _open("NUL", _O_WRONLY);
+  #else
+  const int sink = open("/dev/null", O_WRONLY);
+  #endif
+  if (sink < 0) {
+    std::printf("FAIL couldn't open the null device\n");
+    return EXIT_FAILURE;
+  }
+
+  const string text = "a field of a log line";
+  const string expected_red = red(text);
+  const string expected_bold = bold(text);
+  std::ostringstream reference;
+  reference << fg(Color::green) << "text" << color(TEXT, 10, 20, 30) << "more" << reset;
+  const string expected_stream = reference.str();
+  if (expected_red == text) {
+    std::printf("FAIL the colors couldn't be forced\n");
+    return EXIT_FAILURE;
+  }
+
+  std::atomic<int> mismatches{0};
+  std::vector<std::thread> threads;
+  threads.emplace_back([&] { //Probes the terminal again while the other threads color their output
+    for (int iteration = 0; iteration < ITERATIONS / 10; iteration++) {
+      if (!init()) mismatches++;
+    }
+  });
+  for (int index = 0; index < THREADS; index++) {
+    threads.emplace_back([&, index] {
+      for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+        if (red(text) != expected_red) mismatches++;
+        if (bold(string(text)) != expected_bold) mismatches++;
+
+        std::ostringstream os;
+        os << fg(Color::green) << "text" << color(TEXT, 10, 20, 30) << "more" << reset;
+        if (os.str() != expected_stream) mismatches++;
+
+        //Every thread uses its own runtime colors, so the caches keep replacing their entries
+        const uint8_t shade = static_cast<uint8_t>(iteration * THREADS + index);
+        if (!write_styled(sink, fg(shade, 255 - shade, 128) | Attribute::bold, "styled\n")) mismatches++;
+        StyledLine(sink) << fg256(shade) << "line " << iteration;
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  #ifdef _WIN32
+  _close(sink);
+  #else
+  close(sink);
+  #endif
+  if (mismatches != 0) {
+    std::printf("FAIL %d results differed from the single threaded ones\n", mismatches.load());
+    return EXIT_FAILURE;
+  }
+  std::printf("ok   %d threads, %d iterations each\n", THREADS, ITERATIONS);
+  return EXIT_SUCCESS;
+}